@@ -0,0 +1,94 @@
+#include <algorithm>
+#include <chrono>
+#include <format>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
+#include "terrain/noise/opensimplex2s.hpp"
+
+// Compares scalar OpenSimplex2S::noise2 against the batched float/double variants in points per second,
+// and the cost of also producing analytic derivatives
+int main() {
+    constexpr int num_points{1 << 22};
+    constexpr int repeats{5};
+
+    const OpenSimplex2S simplex{0};
+    std::vector<float> xs(num_points), ys(num_points), out(num_points), out_dx(num_points), out_dy(num_points);
+    std::vector<double> xs_d(num_points), ys_d(num_points), out_d(num_points);
+    std::mt19937_64 engine{1};
+    std::uniform_real_distribution distribution{-512.f, 512.f};
+    for (int i = 0; i < num_points; i++) {
+        xs[i] = distribution(engine);
+        ys[i] = distribution(engine);
+        xs_d[i] = xs[i];
+        ys_d[i] = ys[i];
+    }
+
+    // Best of N runs, reported in points/second
+    const auto measure = [&](const std::string& name, auto&& run) {
+        double best{std::numeric_limits<double>::max()};
+        for (int r = 0; r < repeats; r++) {
+            const auto start{std::chrono::steady_clock::now()};
+            run();
+            const std::chrono::duration<double> elapsed{std::chrono::steady_clock::now() - start};
+            best = std::min(best, elapsed.count());
+        }
+        std::cout << std::format("{:<16} {:8.1f} Mpoints/s", name, num_points / best / 1e6) << std::endl;
+    };
+
+    double sink{};
+    measure("scalar", [&] {
+        for (int i = 0; i < num_points; i++) {
+            sink += simplex.noise2(xs_d[i], ys_d[i]);
+        }
+    });
+    measure("batch (float)", [&] { simplex.noise2(xs, ys, out); });
+    measure("batch (double)", [&] { simplex.noise2(xs_d, ys_d, out_d); });
+    measure("scalar + grad", [&] {
+        for (int i = 0; i < num_points; i++) {
+            sink += simplex.noise2_with_gradient(xs_d[i], ys_d[i]).dx;
+        }
+    });
+    measure("batch + grad", [&] { simplex.noise2_with_gradient(xs, ys, out, out_dx, out_dy); });
+
+    // Regular grid (as sampled by Heightmap and FractalNoise), 2048 x 2048 points about 25 samples per lattice cell
+    // apart. The row evaluator only differs from the batch on builds without the AVX2/AVX-512 kernels
+    constexpr int grid_size{1 << 11};
+    static_assert(grid_size * grid_size == num_points);
+    constexpr double grid_step{0.04};
+    std::vector<float> row_xs(grid_size), row_ys(grid_size);
+    for (int i = 0; i < grid_size; i++) {
+        row_xs[i] = static_cast<float>(i * grid_step);
+    }
+    const auto row_of = [&](std::vector<float>& v, const int j) {
+        return std::span{v}.subspan(static_cast<std::size_t>(j) * grid_size, grid_size);
+    };
+    measure("grid: batch", [&] {
+        for (int j = 0; j < grid_size; j++) {
+            std::fill(row_ys.begin(), row_ys.end(), static_cast<float>(j * grid_step));
+            simplex.noise2(row_xs, row_ys, row_of(out, j));
+        }
+    });
+    measure("grid: row", [&] {
+        for (int j = 0; j < grid_size; j++) {
+            simplex.noise2_Row(0, j * grid_step, grid_step, row_of(out, j));
+        }
+    });
+    measure("grid: batch+grad", [&] {
+        for (int j = 0; j < grid_size; j++) {
+            std::fill(row_ys.begin(), row_ys.end(), static_cast<float>(j * grid_step));
+            simplex.noise2_with_gradient(row_xs, row_ys, row_of(out, j), row_of(out_dx, j), row_of(out_dy, j));
+        }
+    });
+    measure("grid: row+grad", [&] {
+        for (int j = 0; j < grid_size; j++) {
+            simplex.noise2_Row_with_gradient(0, j * grid_step, grid_step, row_of(out, j), row_of(out_dx, j), row_of(out_dy, j));
+        }
+    });
+
+    // Keep the scalar loop from being optimized away
+    return sink == 0.123 ? 1 : 0;
+}
@@ -0,0 +1,71 @@
+#include <algorithm>
+#include <chrono>
+#include <format>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+#include "rt/utilities.hpp"
+
+// The generator random_float() used before counter-based streams: a per-thread Mersenne Twister behind a call
+[[gnu::noinline]] static float mersenne_float() {
+    thread_local std::mt19937_64 engine{1};
+    thread_local std::uniform_real_distribution distribution(0.f, 1.f);
+    return distribution(engine);
+}
+
+// Compares the cost of one random value between the old Mersenne Twister, the inline random_float() of an
+// independent stream, bulk fill(), and the low-discrepancy samplers, in nanoseconds per value. The per-bounce
+// rows draw the 8 dimensions of a path vertex after setting its stream, as the renderer does
+int main() {
+    constexpr int num_values{1 << 24};
+    constexpr int repeats{5};
+    constexpr int vertex_dimensions{8};
+
+    // Best of N runs, reported in ns/value
+    double sink{0};
+    const auto measure = [&](const std::string& name, auto&& run) {
+        double best{std::numeric_limits<double>::max()};
+        for (int r = 0; r < repeats; r++) {
+            const auto start{std::chrono::steady_clock::now()};
+            run();
+            const std::chrono::duration<double> elapsed{std::chrono::steady_clock::now() - start};
+            best = std::min(best, elapsed.count());
+        }
+        std::cout << std::format("{:<28} {:6.2f} ns/value", name, best / num_values * 1e9) << std::endl;
+    };
+
+    measure("mt19937_64 + distribution", [&] {
+        for (int i = 0; i < num_values; i++) {
+            sink += mersenne_float();
+        }
+    });
+    Utilities::seed_random_generator(1);
+    measure("random_float()", [&] {
+        for (int i = 0; i < num_values; i++) {
+            sink += Utilities::random_float();
+        }
+    });
+    std::vector<float> values(4096);
+    measure("fill() 4096", [&] {
+        for (int i = 0; i < num_values; i += static_cast<int>(values.size())) {
+            Utilities::fill(values);
+            sink += values.back();
+        }
+    });
+
+    for (const auto& [name, sampler] : {std::pair{"independent", Utilities::Sampler::Independent}, std::pair{"sobol", Utilities::Sampler::Sobol},
+                                        std::pair{"owen", Utilities::Sampler::Owen}, std::pair{"bluenoise", Utilities::Sampler::BlueNoise}}) {
+        Utilities::set_sampler(sampler);
+        measure(std::format("per bounce, {}", name), [&] {
+            for (int i = 0; i < num_values / vertex_dimensions; i++) {
+                Utilities::set_random_stream(1, i & 1023, i >> 10 & 1023, static_cast<uint32_t>(i >> 20), 1);
+                for (int dimension = 0; dimension < vertex_dimensions; dimension++) {
+                    sink += Utilities::random_float();
+                }
+            }
+        });
+    }
+    std::cout << std::format("(checksum {:.0f})", sink) << std::endl;
+}
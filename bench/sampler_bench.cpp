@@ -0,0 +1,116 @@
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <format>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "rt/utilities.hpp"
+
+// Estimates integrals with a known value in every pixel of a 64x64 image, using the random streams of each
+// Utilities::Sampler exactly as the renderer does, and reports the RMSE over the pixels as the sample count doubles.
+// The 2x2 column averages the errors of neighbouring pixels first (as a reconstruction filter or a viewer's eye
+// does), which is where blue noise error distribution pays off
+int main() {
+    constexpr int image_size{64};
+    constexpr int max_spp{256};
+    constexpr uint64_t seed{1};
+
+    struct Integrand {
+        std::string name;
+        std::function<float()> sample;      // One sample, drawing its dimensions from the current stream
+        double value;                       // Exact integral over the unit hypercube
+    };
+    const double gaussian_1d{std::sqrt(M_PI / 8) * std::erf(std::sqrt(8.0) / 2)};
+    const std::vector<Integrand> integrands{
+        {"disk 2D", [] {
+            const float x{Utilities::random_float()};
+            const float y{Utilities::random_float()};
+            return x * x + y * y < 1.f ? 1.f : 0.f;
+        }, M_PI / 4},
+        {"gaussian 2D", [] {
+            const float x{Utilities::random_float() - 0.5f};
+            const float y{Utilities::random_float() - 0.5f};
+            return std::exp(-8.f * (x * x + y * y));
+        }, gaussian_1d * gaussian_1d},
+        {"step 4D", [] {
+            // Couples the two dimension pairs, like a visibility test depending on the pixel and the bounce direction
+            const float u0{Utilities::random_float()};
+            const float u1{Utilities::random_float()};
+            const float u2{Utilities::random_float()};
+            const float u3{Utilities::random_float()};
+            return u0 < 0.3f + 0.4f * u2 ? u1 + u3 : 0.f;
+        }, 0.5},
+    };
+    const std::array<std::pair<std::string, Utilities::Sampler>, 4> samplers{{
+        {"independent", Utilities::Sampler::Independent},
+        {"sobol", Utilities::Sampler::Sobol},
+        {"owen", Utilities::Sampler::Owen},
+        {"bluenoise", Utilities::Sampler::BlueNoise},
+    }};
+
+    for (const auto& [sampler_name, sampler] : samplers) {
+        Utilities::set_sampler(sampler);
+        std::cout << std::format("{}\n{:>5}", sampler_name, "spp");
+        for (const Integrand& integrand : integrands) {
+            std::cout << std::format(" {:>12}", integrand.name);
+        }
+        std::cout << std::format(" {:>12}", "disk 2x2") << std::endl;
+
+        std::vector<std::vector<double>> sums(integrands.size(), std::vector<double>(image_size * image_size));
+        int spp{0};
+        std::array<double, 2> disk_rmse{};      // At 1 and max_spp, for the convergence rate
+        for (int next_spp = 1; next_spp <= max_spp; next_spp *= 2) {
+            for (; spp < next_spp; spp++) {
+                for (int y = 0; y < image_size; y++) {
+                    for (int x = 0; x < image_size; x++) {
+                        for (size_t i = 0; i < integrands.size(); i++) {
+                            Utilities::set_random_stream(seed, x, y, spp, static_cast<uint32_t>(i));
+                            sums[i][y * image_size + x] += integrands[i].sample();
+                        }
+                    }
+                }
+            }
+
+            std::cout << std::format("{:>5}", spp);
+            for (size_t i = 0; i < integrands.size(); i++) {
+                double squared_error{0};
+                for (const double sum : sums[i]) {
+                    squared_error += (sum / spp - integrands[i].value) * (sum / spp - integrands[i].value);
+                }
+                const double rmse{std::sqrt(squared_error / static_cast<double>(sums[i].size()))};
+                std::cout << std::format(" {:>12.6f}", rmse);
+                if (i == 0 && (spp == 1 || spp == max_spp)) {
+                    disk_rmse[spp == 1 ? 0 : 1] = rmse;
+                }
+            }
+            double filtered_error{0};
+            for (int y = 0; y < image_size; y += 2) {
+                for (int x = 0; x < image_size; x += 2) {
+                    const double mean{(sums[0][y * image_size + x] + sums[0][y * image_size + x + 1] +
+                                       sums[0][(y + 1) * image_size + x] + sums[0][(y + 1) * image_size + x + 1]) / (4.0 * spp)};
+                    filtered_error += (mean - integrands[0].value) * (mean - integrands[0].value);
+                }
+            }
+            std::cout << std::format(" {:>12.6f}", std::sqrt(filtered_error / (image_size * image_size / 4))) << std::endl;
+        }
+        std::cout << std::format("disk 2D RMSE ~ spp^{:.2f}\n", std::log2(disk_rmse[1] / disk_rmse[0]) / std::log2(max_spp)) << std::endl;
+    }
+
+    // Cost of one value, stream setup included
+    constexpr int num_values{1 << 24};
+    for (const auto& [sampler_name, sampler] : samplers) {
+        Utilities::set_sampler(sampler);
+        float sink{0};
+        const auto start{std::chrono::steady_clock::now()};
+        for (int i = 0; i < num_values / 8; i++) {
+            Utilities::set_random_stream(seed, i & 1023, i >> 10, static_cast<uint32_t>(i), 1);
+            for (int dimension = 0; dimension < 8; dimension++) {
+                sink += Utilities::random_float();
+            }
+        }
+        const std::chrono::duration<double> elapsed{std::chrono::steady_clock::now() - start};
+        std::cout << std::format("{:<12} {:6.2f} ns/value (checksum {:.0f})", sampler_name, elapsed.count() / num_values * 1e9, sink) << std::endl;
+    }
+}
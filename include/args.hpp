@@ -3,17 +3,80 @@
 
 #include <arpa/inet.h>
 #include <argp.h>
+#include <cstdio>
 #include <cstring>
 #include <iostream>
 #include <random>
 #include <string>
+#include <vector>
+#include "rt/utilities.hpp"
+#include "terrain/noise/fractal_noise.hpp"
 
 struct run_arguments {
     uint64_t seed;              // Random number generator seed, affects noise function for terrain
     int spp;                    // Parent rays per pixel
     float triangle_length;      // Heightmap triangle lengths
+    FractalSettings fractal;    // Terrain noise octaves
+    int preview_width;          // Noise preview size, 0 to render the scene instead
+    int preview_height;
+    int image_width;            // Output resolution
+    int image_height;
+    int crop_x;                 // Window of the image to render, the whole image when crop_width is 0
+    int crop_y;
+    int crop_width;
+    int crop_height;
+    bool pad_crop;              // Write the window into an image of the full resolution instead of on its own
+    int tile_size;              // Edge length of the pixel tiles render threads work on
+    int threads;                // Render threads, 0 for one per CPU
+    bool pin_threads;           // Pin each render thread to its own CPU
+    bool scaling;               // Report the render's scaling over 1 to all threads instead of rendering
+    bool pilot_pass;            // Schedule tiles by the cost measured in a 1 spp pilot pass
+    double time_budget;         // Progressive render deadline in seconds, 0 for none
+    double write_interval;      // Seconds between intermediate images of a progressive render, 0 for none
+    float adaptive_threshold;   // Relative error at which adaptive sampling stops a pixel, 0 for uniform sampling
+    int min_spp;                // Samples every pixel takes before adaptive sampling may stop it
+    bool wavefront;             // Use the wavefront render engine
+    bool primary_packets;       // Trace camera rays as 4x4 packets
+    bool light_sampling;        // Next-event estimation at diffuse bounces
+    Utilities::Sampler sampler; // Source of the per-sample random values
+    double checkpoint_interval; // Seconds between render checkpoints, 0 for none
+    bool resume;                // Continue from the last checkpoint
+    int worker;                 // Index of this process in a distributed render
+    int num_workers;            // Processes sharing the frame, 1 to render it alone
+    bool split_tiles;           // Distribute tiles instead of sample ranges between workers
+    bool denoise;               // Denoise the final image
+    bool write_aovs;            // Also write the first-hit albedo, normal and depth images
+    std::string reference;      // Accumulation file to report the final image's RMSE against, empty for none
+    int downscale;              // Path-trace at 1/downscale resolution and upsample
+    bool merge;                 // Merge the accumulation files in merge_inputs into image.ppm instead of rendering
+    std::vector<std::string> merge_inputs;
 };
 
+// Keys of options without a short form (outside the printable character range)
+constexpr int OPTION_TILE_SIZE{0x100};
+constexpr int OPTION_PILOT{0x101};
+constexpr int OPTION_TIME_BUDGET{0x102};
+constexpr int OPTION_WRITE_INTERVAL{0x103};
+constexpr int OPTION_ADAPTIVE{0x104};
+constexpr int OPTION_MIN_SPP{0x105};
+constexpr int OPTION_WAVEFRONT{0x106};
+constexpr int OPTION_NO_PACKETS{0x107};
+constexpr int OPTION_NO_NEE{0x108};
+constexpr int OPTION_CHECKPOINT{0x109};
+constexpr int OPTION_RESUME{0x10a};
+constexpr int OPTION_WORKER{0x10b};
+constexpr int OPTION_SPLIT{0x10c};
+constexpr int OPTION_MERGE{0x10d};
+constexpr int OPTION_SAMPLER{0x10e};
+constexpr int OPTION_DENOISE{0x10f};
+constexpr int OPTION_AOVS{0x110};
+constexpr int OPTION_REFERENCE{0x111};
+constexpr int OPTION_DOWNSCALE{0x112};
+constexpr int OPTION_CROP{0x113};
+constexpr int OPTION_PAD_CROP{0x114};
+constexpr int OPTION_PIN_THREADS{0x115};
+constexpr int OPTION_SCALING{0x116};
+
 inline error_t arg_parser(int key, char *arg, argp_state *state);
 
 /**
@@ -28,13 +91,44 @@ inline run_arguments arg_parseopt(const int argc, char *argv[]) {
     argp_option options[] = {
         { "seed", 's', "seed", 0, "Seed for terrain generation, can be any non-negative integer up to 18446744073709551615. Default: random seed", 0},
         { "spp", 'n', "samples", 0, "Samples (number of parent/camera rays) per pixel. Increase for less noise. Default: 10", 0},
-        { "tri", 't', "triangles", 0, "Length of triangle edges per equilateral triangle that makes up the terrain. Decrease for more triangles. 0 < t ≤ 1. Default: 0.5", 0}
+        { "tri", 't', "triangles", 0, "Length of triangle edges per equilateral triangle that makes up the terrain. Decrease for more triangles. 0 < t ≤ 1. Default: 0.5", 0},
+        { "octaves", 'o', "octaves", 0, "Number of fractal noise octaves summed for the terrain. Default: 1", 0},
+        { "fractal", 'f', "type", 0, "Shaping of each terrain noise octave: fbm, ridged or billow. Default: fbm", 0},
+        { "lacunarity", 'l', "lacunarity", 0, "Frequency multiplier between terrain noise octaves. Default: 2", 0},
+        { "gain", 'g', "gain", 0, "Amplitude multiplier between terrain noise octaves. Default: 0.5", 0},
+        { "preview", 'p', "WxH", 0, "Only render a WxH noise.ppm preview of the terrain noise (with the seed and octave options above) and exit, e.g. 7680x4320", 0},
+        { "resolution", 'r', "WxH", 0, "Resolution of the rendered image, e.g. 3840x2160. Default: 1920x1080", 0},
+        { "crop", OPTION_CROP, "WxH+X+Y", 0, "Only render the WxH window at column X, row Y of the image (e.g. 320x180+800+450), into an image of its own", 0},
+        { "pad-crop", OPTION_PAD_CROP, nullptr, 0, "Write a --crop into a black image of the full resolution, at its position", 0},
+        { "threads", 'j', "threads", 0, "Number of render threads, kept for the whole run. Default: one per CPU the process may run on", 0},
+        { "pin-threads", OPTION_PIN_THREADS, nullptr, 0, "Pin each render thread to its own CPU (Linux), next to its buffers and the pixels of its own tiles of passes not ordered by tile cost", 0},
+        { "scaling", OPTION_SCALING, nullptr, 0, "Time the render's samples with 1, 2, 4, ... threads up to -j and report the speedup instead of writing an image", 0},
+        { "tile-size", OPTION_TILE_SIZE, "pixels", 0, "Edge length of the square pixel tiles handed out to render threads. Default: 16", 0},
+        { "pilot", OPTION_PILOT, nullptr, 0, "Render a 1 spp pilot pass first (counted towards -n), then render the most expensive tiles first", 0},
+        { "time-budget", OPTION_TIME_BUDGET, "seconds", 0, "Render progressively (passes of doubling spp) and stop at this many seconds or -n spp, whichever comes first", 0},
+        { "write-interval", OPTION_WRITE_INTERVAL, "seconds", 0, "Render progressively and update image.ppm every this many seconds", 0},
+        { "adaptive", OPTION_ADAPTIVE, "error", 0, "Sample adaptively: pixels stop once the relative error of their mean drops to this (e.g. 0.01), -n becomes the per-pixel maximum", 0},
+        { "min-spp", OPTION_MIN_SPP, "samples", 0, "Samples every pixel takes before --adaptive may stop it. Default: 16", 0},
+        { "wavefront", OPTION_WAVEFRONT, nullptr, 0, "Trace each tile's paths in bounce-synchronous batches with coherence-sorted rays instead of one at a time", 0},
+        { "no-packets", OPTION_NO_PACKETS, nullptr, 0, "Trace camera rays one at a time instead of in 4x4 pixel packets", 0},
+        { "no-nee", OPTION_NO_NEE, nullptr, 0, "Only find lights by bouncing into them, without next-event estimation", 0},
+        { "sampler", OPTION_SAMPLER, "type", 0, "Random values of the samples: independent, sobol, owen (scrambled Sobol) or bluenoise. Default: owen", 0},
+        { "checkpoint", OPTION_CHECKPOINT, "seconds", 0, "Save the accumulated samples to image.checkpoint every this many seconds (at least 100 times a checkpoint's write time), at the end, and on SIGINT/SIGTERM", 0},
+        { "resume", OPTION_RESUME, nullptr, 0, "Continue the render saved in image.checkpoint (same seed and resolution) up to -n spp", 0},
+        { "worker", OPTION_WORKER, "K/N", 0, "Render only part K (0 to N-1) of a frame split between N processes, writing image.workerK.checkpoint instead of an image", 0},
+        { "split", OPTION_SPLIT, "mode", 0, "How --worker splits the frame: samples (a share of every pixel's -n) or tiles. Default: samples", 0},
+        { "denoise", OPTION_DENOISE, nullptr, 0, "Filter the final image with an edge-avoiding a-trous denoiser guided by the first-hit albedo, normal and depth", 0},
+        { "aovs", OPTION_AOVS, nullptr, 0, "Also write the first-hit albedo, normal and depth to albedo.ppm, normal.ppm and depth.ppm", 0},
+        { "reference", OPTION_REFERENCE, "file", 0, "Report the RMSE of the final image (and of the denoised one) against this accumulation file of a converged render", 0},
+        { "downscale", OPTION_DOWNSCALE, "factor", 0, "Path-trace at 1/factor of the resolution (e.g. 2 or 4) and upsample to it, guided by a full-resolution pass of camera rays. Default: 1", 0},
+        { "merge", OPTION_MERGE, nullptr, 0, "Merge the accumulation files given as arguments (worker or checkpoint files) into image.ppm and exit", 0},
+        { nullptr, 0, nullptr, 0, nullptr, 0 }
     };
 
     const argp argp_settings = {
         options,
         arg_parser,
-        nullptr,
+        "[--merge FILE...]",
         nullptr,
         nullptr,
         nullptr,
@@ -47,6 +141,16 @@ inline run_arguments arg_parseopt(const int argc, char *argv[]) {
     args.seed = rd();
     args.spp = 10;
     args.triangle_length = 0.5f;
+    args.image_width = 1920;
+    args.image_height = 1080;
+    args.fractal = FractalSettings{};
+    args.tile_size = 16;
+    args.min_spp = 16;
+    args.primary_packets = true;
+    args.light_sampling = true;
+    args.sampler = Utilities::Sampler::Owen;
+    args.num_workers = 1;
+    args.downscale = 1;
 
     if (argp_parse(&argp_settings, argc, argv, 0, nullptr, &args) != 0) {
         std::cerr << "Error while parsing" << std::endl;
@@ -86,6 +190,219 @@ inline error_t arg_parser(const int key, char *arg, argp_state *state) {
         }
         break;
 	}
+	case 'o': {
+        args->fractal.octaves = std::stoi(arg);
+        if (args->fractal.octaves < 1) {
+            argp_error(state, "Invalid octave count, must be at least 1");
+        }
+        break;
+	}
+	case 'f': {
+        const std::string type{arg};
+        if (type == "fbm") {
+            args->fractal.type = FractalType::Fbm;
+        } else if (type == "ridged") {
+            args->fractal.type = FractalType::Ridged;
+        } else if (type == "billow") {
+            args->fractal.type = FractalType::Billow;
+        } else {
+            argp_error(state, "Invalid fractal type, must be fbm, ridged or billow");
+        }
+        break;
+	}
+	case 'l': {
+        args->fractal.lacunarity = std::stof(arg);
+        if (args->fractal.lacunarity <= 0) {
+            argp_error(state, "Invalid lacunarity, must be greater than 0");
+        }
+        break;
+	}
+	case 'g': {
+        args->fractal.gain = std::stof(arg);
+        if (args->fractal.gain <= 0) {
+            argp_error(state, "Invalid gain, must be greater than 0");
+        }
+        break;
+	}
+	case 'p': {
+        char trailing{};
+        if (std::sscanf(arg, "%dx%d%c", &args->preview_width, &args->preview_height, &trailing) != 2
+            || args->preview_width <= 0 || args->preview_height <= 0) {
+            argp_error(state, "Invalid preview size, must be WIDTHxHEIGHT with both greater than 0");
+        }
+        break;
+	}
+	case 'r': {
+        char trailing{};
+        if (std::sscanf(arg, "%dx%d%c", &args->image_width, &args->image_height, &trailing) != 2
+            || args->image_width <= 0 || args->image_height <= 0) {
+            argp_error(state, "Invalid resolution, must be WIDTHxHEIGHT with both greater than 0");
+        }
+        break;
+	}
+	case OPTION_CROP: {
+        char trailing{};
+        if (std::sscanf(arg, "%dx%d+%d+%d%c", &args->crop_width, &args->crop_height, &args->crop_x, &args->crop_y, &trailing) != 4
+            || args->crop_width <= 0 || args->crop_height <= 0 || args->crop_x < 0 || args->crop_y < 0) {
+            argp_error(state, "Invalid crop, must be WIDTHxHEIGHT+X+Y with a size greater than 0");
+        }
+        break;
+	}
+	case OPTION_PAD_CROP: {
+        args->pad_crop = true;
+        break;
+	}
+	case 'j': {
+        args->threads = std::stoi(arg);
+        if (args->threads < 1) {
+            argp_error(state, "Invalid thread count, must be at least 1");
+        }
+        break;
+	}
+	case OPTION_PIN_THREADS: {
+        args->pin_threads = true;
+        break;
+	}
+	case OPTION_SCALING: {
+        args->scaling = true;
+        break;
+	}
+	case OPTION_TILE_SIZE: {
+        args->tile_size = std::stoi(arg);
+        if (args->tile_size < 1) {
+            argp_error(state, "Invalid tile size, must be at least 1");
+        }
+        break;
+	}
+	case OPTION_PILOT: {
+        args->pilot_pass = true;
+        break;
+	}
+	case OPTION_TIME_BUDGET: {
+        args->time_budget = std::stod(arg);
+        if (args->time_budget <= 0) {
+            argp_error(state, "Invalid time budget, must be greater than 0");
+        }
+        break;
+	}
+	case OPTION_WRITE_INTERVAL: {
+        args->write_interval = std::stod(arg);
+        if (args->write_interval <= 0) {
+            argp_error(state, "Invalid write interval, must be greater than 0");
+        }
+        break;
+	}
+	case OPTION_ADAPTIVE: {
+        args->adaptive_threshold = std::stof(arg);
+        if (args->adaptive_threshold <= 0) {
+            argp_error(state, "Invalid adaptive error threshold, must be greater than 0");
+        }
+        break;
+	}
+	case OPTION_MIN_SPP: {
+        args->min_spp = std::stoi(arg);
+        if (args->min_spp < 2) {
+            argp_error(state, "Invalid minimum spp, must be at least 2 to estimate variance");
+        }
+        break;
+	}
+	case OPTION_WAVEFRONT: {
+        args->wavefront = true;
+        break;
+	}
+	case OPTION_NO_PACKETS: {
+        args->primary_packets = false;
+        break;
+	}
+	case OPTION_NO_NEE: {
+        args->light_sampling = false;
+        break;
+	}
+	case OPTION_CHECKPOINT: {
+        args->checkpoint_interval = std::stod(arg);
+        if (args->checkpoint_interval <= 0) {
+            argp_error(state, "Invalid checkpoint interval, must be greater than 0");
+        }
+        break;
+	}
+	case OPTION_RESUME: {
+        args->resume = true;
+        break;
+	}
+	case OPTION_SAMPLER: {
+        const std::string type{arg};
+        if (type == "independent") {
+            args->sampler = Utilities::Sampler::Independent;
+        } else if (type == "sobol") {
+            args->sampler = Utilities::Sampler::Sobol;
+        } else if (type == "owen") {
+            args->sampler = Utilities::Sampler::Owen;
+        } else if (type == "bluenoise") {
+            args->sampler = Utilities::Sampler::BlueNoise;
+        } else {
+            argp_error(state, "Invalid sampler, must be independent, sobol, owen or bluenoise");
+        }
+        break;
+	}
+	case OPTION_WORKER: {
+        char trailing{};
+        if (std::sscanf(arg, "%d/%d%c", &args->worker, &args->num_workers, &trailing) != 2
+            || args->num_workers < 1 || args->worker < 0 || args->worker >= args->num_workers) {
+            argp_error(state, "Invalid worker, must be K/N with 0 <= K < N");
+        }
+        break;
+	}
+	case OPTION_SPLIT: {
+        const std::string mode{arg};
+        if (mode == "samples") {
+            args->split_tiles = false;
+        } else if (mode == "tiles") {
+            args->split_tiles = true;
+        } else {
+            argp_error(state, "Invalid split mode, must be samples or tiles");
+        }
+        break;
+	}
+	case OPTION_DENOISE: {
+        args->denoise = true;
+        break;
+	}
+	case OPTION_AOVS: {
+        args->write_aovs = true;
+        break;
+	}
+	case OPTION_REFERENCE: {
+        args->reference = arg;
+        break;
+	}
+	case OPTION_DOWNSCALE: {
+        args->downscale = std::stoi(arg);
+        if (args->downscale < 1 || args->downscale > 8) {
+            argp_error(state, "Invalid downscale factor, must be between 1 and 8");
+        }
+        break;
+	}
+	case OPTION_MERGE: {
+        args->merge = true;
+        break;
+	}
+	case ARGP_KEY_ARG: {
+        args->merge_inputs.emplace_back(arg);
+        break;
+	}
+	case ARGP_KEY_END: {
+        if (args->merge && args->merge_inputs.empty()) {
+            argp_error(state, "--merge needs at least one accumulation file");
+        } else if (!args->merge && !args->merge_inputs.empty()) {
+            argp_error(state, "Unexpected argument %s, files are only taken with --merge", args->merge_inputs.front().c_str());
+        } else if (args->crop_x + args->crop_width > args->image_width || args->crop_y + args->crop_height > args->image_height) {
+            argp_error(state, "Crop %dx%d+%d+%d does not fit into the %dx%d image", args->crop_width, args->crop_height,
+                       args->crop_x, args->crop_y, args->image_width, args->image_height);
+        } else if (args->pad_crop && args->crop_width == 0) {
+            argp_error(state, "--pad-crop needs a --crop");
+        }
+        break;
+	}
 	default:
 		ret = ARGP_ERR_UNKNOWN;
 		break;
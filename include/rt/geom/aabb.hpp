@@ -4,6 +4,7 @@
 #include <cmath>
 #include <stdexcept>
 #include "rt/math/interval.hpp"
+#include "rt/math/ray_packet.hpp"
 #include "rt/math/vec3.hpp"
 
 class HitRecord;
@@ -108,6 +109,17 @@ public:
      */
     [[nodiscard]] bool ray_hit(const Ray& ray, Interval<float> t) const;
 
+    /**
+     * @brief Checks every lane of a ray packet for intersections with the current Aabb at once.
+     * @param packet Rays to check.
+     * @param active Lanes of the packet to check.
+     * @param t_min Intersections only count beyond this t, for every lane.
+     * @param t_max Per-lane upper t limit.
+     * @return Active lanes whose ray intersects the current aabb.
+     */
+    [[nodiscard]] RayPacket::Mask packet_hit(const RayPacket& packet, RayPacket::Mask active, float t_min,
+                                             const std::array<float, RayPacket::SIZE>& t_max) const;
+
     /** @return True if the Aabb is degenerate (no volume) or "empty." */
     [[nodiscard]] constexpr bool is_degenerate() const {
         if (x_.is_empty() || y_.is_empty() || z_.is_empty()) { return true; }
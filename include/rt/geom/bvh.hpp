@@ -70,6 +70,41 @@ public:
         return hit_left || hit_right;
     }
 
+    /**
+     * @brief Checks whether anything in the tree lies on the ray, stopping at the first primitive hit.
+     * @param ray Checked for intersections with the current AABB.
+     * @param t Intersections only count if they occur in the specified t Interval.
+     * @return True if ray intersects any primitive of this subtree, false otherwise.
+     */
+    [[nodiscard]] bool occluded(const Ray& ray, const Interval<float>& t) const override {
+        if (!bbox_.ray_hit(ray, t)) {
+            return false;
+        }
+        return left_->occluded(ray, t) || (right_ != left_ && right_->occluded(ray, t));
+    }
+
+    /**
+     * @brief Traverses the tree with a whole ray packet, lanes drop out individually at the nodes they miss.
+     * @param packet Rays to check for intersections.
+     * @param active Lanes of the packet to check.
+     * @param t_min Intersections only count beyond this t, for every lane.
+     * @param t_max Per-lane upper t limit, lowered to the t of every new closest hit.
+     * @param hit_records Per-lane hit information, updated for the lanes that hit.
+     * @return Lanes that hit anything in this subtree closer than their t_max.
+     */
+    RayPacket::Mask packet_hit(const RayPacket& packet, const RayPacket::Mask active, const float t_min,
+                               std::array<float, RayPacket::SIZE>& t_max, std::array<HitRecord, RayPacket::SIZE>& hit_records) const override {
+        const RayPacket::Mask entering{bbox_.packet_hit(packet, active, t_min, t_max)};
+        if (!entering) {
+            return 0;
+        }
+
+        // Single-primitive leaves store the primitive as both children
+        const RayPacket::Mask hit_left{left_->packet_hit(packet, entering, t_min, t_max, hit_records)};
+        const RayPacket::Mask hit_right{right_ == left_ ? 0 : right_->packet_hit(packet, entering, t_min, t_max, hit_records)};
+        return hit_left | hit_right;
+    }
+
     /** @return Axis-aligned bounding box of this node. */
     [[nodiscard]] Aabb bounding_box() const override { return bbox_; }
 
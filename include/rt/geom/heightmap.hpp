@@ -5,6 +5,8 @@
 #include "hittable.hpp"
 
 class Triangle;
+class OpenSimplex2S;
+class FractalNoise;
 
 using std::shared_ptr;
 using std::function;
@@ -42,6 +44,48 @@ public:
         }
     }
 
+    /**
+     * @brief Constructs a new Heightmap whose vertex heights are sampled from 2D simplex noise.
+     *
+     * Each grid row is evaluated with a single OpenSimplex2S::noise2_Row_with_gradient() call, which also yields
+     * the analytic vertex normals used to smooth-shade the terrain.
+     * @param noise Noise that will determine the procedural pattern of heights in the Heightmap.
+     * @param frequency Noise-space distance between neighbouring vertices.
+     * @param corner Corner coordinates, where the first vertex will be.
+     * @param grid_square_length Length of each grid square in the Heightmap.
+     * @param length Length of the Heightmap grid, in number of grid squares.
+     * @param width Width of the Heightmap grid, in number of grid squares.
+     */
+    Heightmap(
+        const OpenSimplex2S& noise,
+        float frequency,
+        const coord3& corner,
+        float grid_square_length,
+        int length,
+        int width
+    );
+
+    /**
+     * @brief Constructs a new Heightmap whose vertex heights are sampled from multi-octave fractal noise.
+     *
+     * The whole grid is filled from FractalNoise's cached octave tiles in one pass, together with the analytic vertex
+     * normals used to smooth-shade the terrain.
+     * @param noise Fractal noise that will determine the procedural pattern of heights in the Heightmap.
+     * @param frequency Noise-space distance between neighbouring vertices (at the first octave).
+     * @param corner Corner coordinates, where the first vertex will be.
+     * @param grid_square_length Length of each grid square in the Heightmap.
+     * @param length Length of the Heightmap grid, in number of grid squares.
+     * @param width Width of the Heightmap grid, in number of grid squares.
+     */
+    Heightmap(
+        const FractalNoise& noise,
+        float frequency,
+        const coord3& corner,
+        float grid_square_length,
+        int length,
+        int width
+    );
+
     /**
      * @brief Constructs triangles arranged in grid arrangement, where each grid square are of unit dimensions and composed
      * of two Triangles.
@@ -49,10 +93,19 @@ public:
      */
     [[nodiscard]] std::vector<shared_ptr<Triangle>> construct_map() const;
 private:
+    /**
+     * @brief Converts height derivatives into a vertex normal.
+     * @param dx Height change per grid square along x.
+     * @param dz Height change per grid square along z.
+     * @return Upward-facing unit normal of the height field.
+     */
+    [[nodiscard]] uvec3 normal_from_slope(float dx, float dz) const;
+
     coord3 corner_;                         // Location of first grid square
     float grid_square_len_;                 // Length of each grid square
     int length_, width_;                    // Num of grid squares per length/width
     std::vector<float> vertices_heights_;   // Vertices stored effectively in "heightmap-space" (relative to heightmap grid)
+    std::vector<uvec3> vertices_normals_;   // Per-vertex normals, empty for flat-shaded maps
 };
 
 #endif
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include "rt/scene/material.hpp"
 #include "rt/math/vec3.hpp"
 #include "rt/math/interval.hpp"
+#include "rt/math/ray_packet.hpp"
 class Ray;
 class Aabb;
 
@@ -69,6 +70,12 @@ public:
      */
     bool bounce(const Ray& ray, Color& attenuation, Ray& next) const;
 
+    /**
+     * @brief bounce(), also reporting which lobe of the Material produced the child ray.
+     * @param diffuse Set to true if the child ray was scattered diffusely (cosine-weighted), false otherwise.
+     */
+    bool bounce(const Ray& ray, Color& attenuation, Ray& next, bool& diffuse) const;
+
     /**
      * @brief Determines the color of the emitted light from the hit surface.
      * @return Color of the emitted light (black if the hit Material doesn't emit anything).
@@ -100,6 +107,31 @@ public:
      */
     virtual bool ray_hit(const Ray& ray, const Interval<float>& t, HitRecord& hit_record) const = 0;
 
+    /**
+     * @brief Checks whether anything of the current object lies on the ray (any-hit, for shadow and visibility rays).
+     *
+     * Returns at the first intersection found, without searching for the closest one or computing hit attributes.
+     * @param ray Checked for intersections with the current Hittable object.
+     * @param t Intersections only count if they occur in the specified t Interval.
+     * @return True if ray intersects the current object anywhere in t, false otherwise.
+     */
+    [[nodiscard]] virtual bool occluded(const Ray& ray, const Interval<float>& t) const = 0;
+
+    /**
+     * @brief Intersects every active lane of a ray packet with the current object.
+     *
+     * The default intersects the lanes one at a time with ray_hit(), acceleration structures override it to
+     * traverse with the whole packet and drop lanes individually as they miss.
+     * @param packet Rays to check for intersections.
+     * @param active Lanes of the packet to check.
+     * @param t_min Intersections only count beyond this t, for every lane.
+     * @param t_max Per-lane upper t limit, lowered to the t of every new closest hit.
+     * @param hit_records Per-lane hit information, updated for the lanes that hit.
+     * @return Lanes that hit the current object closer than their t_max.
+     */
+    virtual RayPacket::Mask packet_hit(const RayPacket& packet, RayPacket::Mask active, float t_min,
+                                       std::array<float, RayPacket::SIZE>& t_max, std::array<HitRecord, RayPacket::SIZE>& hit_records) const;
+
     /**
      * @brief Calculates an aabb bounding box for the current object.
      * @return AABB that encompasses the current object.
@@ -50,6 +50,26 @@ public:
      */
     bool ray_hit(const Ray& ray, const Interval<float>& t, HitRecord& hit_record) const override;
 
+    /**
+     * @brief Checks whether any object in the HittableList lies on the ray, stopping at the first one found.
+     * @param ray Checked for intersections with the objects.
+     * @param t Intersections only count if they occur in the specified t Interval.
+     * @return True if ray intersects any Hittable in the HittableList, false otherwise.
+     */
+    [[nodiscard]] bool occluded(const Ray& ray, const Interval<float>& t) const override;
+
+    /**
+     * @brief Intersects a ray packet with every object, keeping each lane's closest hit.
+     * @param packet Rays to check for intersections.
+     * @param active Lanes of the packet to check.
+     * @param t_min Intersections only count beyond this t, for every lane.
+     * @param t_max Per-lane upper t limit, lowered to the t of every new closest hit.
+     * @param hit_records Per-lane hit information, updated for the lanes that hit.
+     * @return Lanes that hit any object in the HittableList.
+     */
+    RayPacket::Mask packet_hit(const RayPacket& packet, RayPacket::Mask active, float t_min,
+                               std::array<float, RayPacket::SIZE>& t_max, std::array<HitRecord, RayPacket::SIZE>& hit_records) const override;
+
 private:
     std::vector<shared_ptr<Hittable>> objects_;
     Aabb bbox_;
@@ -48,6 +48,30 @@ public:
      */
     bool ray_hit(const Ray& ray, const Interval<float>& t, HitRecord& hit_record) const override;
 
+    /**
+     * @brief Checks whether the ray passes through the current Sphere, without computing hit attributes.
+     * @param ray Checked for intersections with the current Sphere.
+     * @param t Intersections only count if they occur in the specified t Interval.
+     * @return True if ray intersects the current Sphere, false otherwise.
+     */
+    [[nodiscard]] bool occluded(const Ray& ray, const Interval<float>& t) const override;
+
+    /**
+     * @brief Samples a direction towards the Sphere, uniformly over the cone of directions it covers from a point.
+     * @param from Point looking at the Sphere.
+     * @param pdf Set to the solid angle density of the sampled direction, 0 if from is inside the Sphere.
+     * @return Direction from the point towards the Sphere.
+     */
+    [[nodiscard]] uvec3 sample_cone(const coord3& from, float& pdf) const;
+
+    /**
+     * @brief Solid angle density with which sample_cone() picks a direction.
+     * @param from Point looking at the Sphere.
+     * @param direction Direction from the point.
+     * @return Density of the direction, 0 if it misses the Sphere or from is inside the Sphere.
+     */
+    [[nodiscard]] float cone_pdf(const coord3& from, const uvec3& direction) const;
+
     /**
      * @brief Calculates an aabb bounding box for the current Sphere.
      * @return AABB that encompasses the current Sphere.
@@ -55,6 +79,13 @@ public:
     [[nodiscard]] Aabb bounding_box() const override { return bbox_; };
 
 private:
+    /**
+     * @brief Ray-sphere intersection shared by ray_hit() and occluded().
+     * @param ray_t Set to the smallest t of the intersections within t.
+     * @return True if ray intersects the current Sphere within t, false otherwise.
+     */
+    bool intersect(const Ray& ray, const Interval<float>& t, float& ray_t) const;
+
     coord3 center_;         // Coordinate position of sphere's center
     float radius_;          // Sphere's radius
     Material material_;     // Material of sphere
@@ -26,6 +26,27 @@ public:
             Interval{fmin(fmin(a.z(), b.z()), c.z()), fmax(fmax(a.z(), b.z()), c.z())}
         } {}
 
+    /**
+     * @brief Constructs a new double-sided, smooth-shaded Triangle with the specified vertices a, b, c.
+     *
+     * The shading normal at a hit is interpolated from the vertex normals instead of using the flat face normal.
+     */
+    constexpr Triangle(
+        const coord3& a,
+        const coord3& b,
+        const coord3& c,
+        const uvec3& normal_a,
+        const uvec3& normal_b,
+        const uvec3& normal_c,
+        const Material& material
+        ) :
+        Triangle{a, b, c, material} {
+        vertex_normals_[0] = normal_a;
+        vertex_normals_[1] = normal_b;
+        vertex_normals_[2] = normal_c;
+        smooth_ = true;
+    }
+
     // Accessors
     /** @return Material of the current Triangle. */
     [[nodiscard]] constexpr Material material() const noexcept { return material_; }
@@ -39,6 +60,14 @@ public:
      */
     bool ray_hit(const Ray& ray, const Interval<float>& t, HitRecord& hit_record) const override;
 
+    /**
+     * @brief Checks whether the ray passes through the current Triangle, without computing hit attributes.
+     * @param ray Checked for intersections with the current Triangle.
+     * @param t Intersections only count if they occur in the specified t Interval.
+     * @return True if ray intersects the current Triangle, false otherwise.
+     */
+    [[nodiscard]] bool occluded(const Ray& ray, const Interval<float>& t) const override;
+
     /**
      * @brief Calculates an aabb bounding box for the current object.
      * @return AABB that encompasses the current object.
@@ -46,9 +75,20 @@ public:
     [[nodiscard]] Aabb bounding_box() const override { return bbox_; }
 
 private:
+    /**
+     * @brief Moller-Trumbore intersection shared by ray_hit() and occluded().
+     * @param ray_t Set to the t of the intersection.
+     * @param u Set to the barycentric weight of vertex b.
+     * @param v Set to the barycentric weight of vertex c.
+     * @return True if ray intersects the current Triangle within t, false otherwise.
+     */
+    bool intersect(const Ray& ray, const Interval<float>& t, float& ray_t, float& u, float& v) const;
+
     coord3 a_;                      // First triangle vertex
     vec3 ab_, ac_;                  // Triangle edges
     uvec3 normal_;
+    uvec3 vertex_normals_[3];       // Per-vertex shading normals of a, b, c (smooth_ only)
+    bool smooth_{false};
     Material material_;
     Aabb bbox_;
 };
@@ -0,0 +1,36 @@
+#ifndef RAY_PACKET_H
+#define RAY_PACKET_H
+
+#include <array>
+#include <cstdint>
+#include "rt/math/ray.hpp"
+
+/**
+ * @struct RayPacket
+ * @brief A 4x4 block of coherent rays (e.g. camera rays of neighbouring pixels) traced through the scene together.
+ *
+ * Origins and reciprocal directions are stored per component, so bounding box tests run over all lanes at once.
+ * Lanes that are not part of a traversal are masked out by the caller.
+ */
+struct RayPacket {
+    static constexpr int SIZE{16};          // Rays per packet (4x4 pixels)
+    using Mask = std::uint32_t;             // Bit i set for lane i
+    static constexpr Mask ALL{(Mask{1} << SIZE) - 1};
+
+    alignas(64) std::array<float, SIZE> origin_x, origin_y, origin_z;
+    alignas(64) std::array<float, SIZE> inverse_x, inverse_y, inverse_z;      // 1 / direction, for slab tests
+    std::array<Ray, SIZE> rays;
+
+    /** @brief Places ray in lane. */
+    void set(const int lane, const Ray& ray) {
+        rays[lane] = ray;
+        origin_x[lane] = ray.origin().x();
+        origin_y[lane] = ray.origin().y();
+        origin_z[lane] = ray.origin().z();
+        inverse_x[lane] = 1.f / ray.direction().x();
+        inverse_y[lane] = 1.f / ray.direction().y();
+        inverse_z[lane] = 1.f / ray.direction().z();
+    }
+};
+
+#endif
@@ -0,0 +1,92 @@
+#ifndef ACCUMULATION_H
+#define ACCUMULATION_H
+
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+#include "rt/math/vec3.hpp"
+
+/** @brief Running sums over the samples of one pixel. */
+struct PixelStats {
+    Color sum;                  // Sum of the sample colors
+    float luminance_sq_sum{0};  // Sum of the squared sample luminances, for the variance
+    int samples{0};
+
+    // First-hit surface of every sample (AOVs), guides for the denoiser
+    Color albedo_sum;           // Sum of the albedos, the sky color for samples that escaped
+    vec3 normal_sum;            // Sum of the normals facing the camera, zero for samples that escaped
+    float depth_sum{0};         // Sum of the hit distances, zero for samples that escaped
+
+    /** @brief Adds the sums of other samples of the same pixel. */
+    void add(const PixelStats& other) {
+        sum += other.sum;
+        luminance_sq_sum += other.luminance_sq_sum;
+        samples += other.samples;
+        albedo_sum += other.albedo_sum;
+        normal_sum += other.normal_sum;
+        depth_sum += other.depth_sum;
+    }
+};
+
+/**
+ * @struct Accumulation
+ * @brief Linear (HDR) per-pixel sample sums of a possibly partial render, as saved in checkpoint and worker files.
+ *
+ * Sums of the same image add up: merging the files of workers that rendered disjoint tiles or disjoint sample
+ * ranges of one frame gives every pixel the spp-weighted mean of all of them. Every pixel holds the consecutive
+ * sample indices from first_sample on (its random streams are keyed by them), which is how merges tell overlapping
+ * inputs apart from disjoint ones.
+ */
+struct Accumulation {
+    int width{0};
+    int height{0};
+    std::uint64_t seed{0};          // Seed of the rendered scene
+    int passes{0};                  // Render passes started so far
+    std::vector<PixelStats> pixels; // Row-major
+    int x0{0};                      // Position of the first pixel in the whole image, for crops
+    int y0{0};
+    int first_sample{0};            // Index of every pixel's first sample, -1 if they do not hold one consecutive range
+
+    static constexpr int GAPS{-1};  // first_sample of a merge whose pixels hold samples with gaps between them
+
+    /**
+     * @brief Saves the sums, written to filename.part first and renamed over filename so readers never see a partial file.
+     * @param filename Accumulation file.
+     */
+    void write(const std::string& filename) const;
+
+    /**
+     * @brief Loads a file saved by write().
+     * @param filename Accumulation file.
+     * @return The saved sums.
+     * @throws std::runtime_error If the file cannot be read or was written by a different build.
+     */
+    static Accumulation read(const std::string& filename);
+
+    /**
+     * @brief Adds up accumulations of the same image that hold disjoint samples.
+     *
+     * The result holds one consecutive range of samples per pixel, all from the same index on, when the parts
+     * join up without gaps (e.g. all workers of a frame, or a single one), and first_sample is GAPS otherwise.
+     * @param parts Sums of the same scene at the same resolution (and crop window), at least one.
+     * @return The summed samples, with the most passes of any part.
+     * @throws std::invalid_argument If the parts are of different resolutions, windows or scene seeds, or two of
+     * them hold the same sample of a pixel (or may, for parts that have gaps themselves).
+     */
+    static Accumulation merge(const std::vector<Accumulation>& parts);
+
+    /**
+     * @brief Checks whether two sets of sums of the same pixels (and seed) share samples.
+     * @param pixels Sums of every pixel.
+     * @param first_sample Index of the first sample of every pixel of pixels, GAPS if they have gaps.
+     * @param other_pixels Sums of the same pixels.
+     * @param other_first_sample Index of the first sample of every pixel of other_pixels, GAPS if they have gaps.
+     * @return True if some pixel holds a sample index in both, or may because either has gaps.
+     */
+    [[nodiscard]] static bool overlap(std::span<const PixelStats> pixels, int first_sample, std::span<const PixelStats> other_pixels,
+                                      int other_first_sample);
+
+};
+
+#endif
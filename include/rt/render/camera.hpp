@@ -46,7 +46,7 @@ public:
         defocus_disk_u_     {u_ * focus_distance_ * std::tan(Utilities::degrees_to_radians(defocus_angle_ / 2))},   // u_ * defocus disk radius
         defocus_disk_v_     {v_ * focus_distance_ * std::tan(Utilities::degrees_to_radians(defocus_angle_ / 2))},   // v_ * defocus disk radius
         num_samples_        {num_samples},
-        image_width_        {static_cast<int>(static_cast<float>(image_height) * aspect_ratio)},
+        image_width_        {static_cast<int>(std::lround(static_cast<float>(image_height) * aspect_ratio))},    // Rounded, so W / H gives back W
         image_height_       {image_height},
         viewport_height_    {2 * std::tan(Utilities::degrees_to_radians(vertical_fov_) / 2)},
         viewport_width_     {viewport_height_ * (static_cast<float>(image_width_) / static_cast<float>(image_height_))},
@@ -119,17 +119,15 @@ private:
      * @Brief Generate a random point on the Camera's defocus disk (virtual aperture).
      *
      * Should be used in the Renderer for generated primary ray origin points to simulate defocus blur.
+     * @param u Uniform random value in [0, 1), picks the distance from the center.
+     * @param v Uniform random value in [0, 1), picks the angle.
      * @return Random coordinate on the Camera's defocus disk.
      */
-    [[nodiscard]] coord3 defocus_disk_sample() const {
-    // Get a random point in the camera defocus disk, then sample a random
-        vec3 p;
-        while (true) {
-            p = vec3{Utilities::random_float({-1, 1}), Utilities::random_float({-1, 1}), 0};
-            if (p.length_squared() < 1) {
-                break;
-            }
-        }
+    [[nodiscard]] coord3 defocus_disk_sample(const float u, const float v) const {
+        // Polar mapping of two random values (uniform by area), so every sample takes exactly two dimensions
+        const float r{std::sqrt(u)};
+        const float phi{2.f * static_cast<float>(M_PI) * v};
+        const vec3 p{r * std::cos(phi), r * std::sin(phi), 0};
         return position_ + p.x() * defocus_disk_u_ + p.y() * defocus_disk_v_;
     }
 };
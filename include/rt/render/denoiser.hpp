@@ -0,0 +1,56 @@
+#ifndef DENOISER_H
+#define DENOISER_H
+
+#include <span>
+#include <vector>
+#include "rt/render/accumulation.hpp"
+#include "rt/render/guide_buffers.hpp"
+#include "rt/math/vec3.hpp"
+
+/**
+ * @class Denoiser
+ * @brief Edge-avoiding à-trous wavelet filter over a rendered image, guided by its first-hit AOVs.
+ *
+ * Colors are divided by their albedo first so surface detail is not blurred, then smoothed in passes of a
+ * 5x5 B3-spline kernel whose taps spread 2^i pixels apart in pass i. Every tap is weighted down where the
+ * normal or depth differs from the center pixel, or where the luminance differs by more than the pixel's noise
+ * (the standard error of its mean, filtered along with the colors), so geometric edges and real shading
+ * detail survive while Monte Carlo noise is averaged out. Pixels with too few samples to know their own noise take
+ * it from the spread of their neighbours on the same surface.
+ */
+class Denoiser {
+public:
+    static constexpr int PASSES{5};             // Kernel footprint of 4 * 2^(PASSES - 1) + 1 pixels
+
+    /**
+     * @brief Prepares the guides of an image.
+     * @param width Image width in pixels.
+     * @param height Image height in pixels.
+     * @param pixels Sample sums of every pixel, including the AOV sums, row-major.
+     * @throws std::invalid_argument If pixels does not hold width * height pixels.
+     */
+    Denoiser(int width, int height, std::span<const PixelStats> pixels);
+
+    /** @return The denoised mean color of every pixel, row-major. */
+    [[nodiscard]] std::vector<Color> denoise() const;
+
+private:
+    int width_;
+    int height_;
+    GuideBuffers guides_;
+    std::vector<Color> irradiance_;     // Mean color divided by the albedo
+    std::vector<float> variance_;       // Variance of the mean luminance of irradiance_, spatial for sparse pixels
+
+    /**
+     * @brief Runs one filter pass over the rows of the image on the shared ThreadPool.
+     * @param step Distance between kernel taps in pixels.
+     * @param color Input colors.
+     * @param variance Input variances of the colors' luminance.
+     * @param color_out Receives the filtered colors.
+     * @param variance_out Receives the filtered variances.
+     */
+    void filter(int step, const std::vector<Color>& color, const std::vector<float>& variance,
+                std::vector<Color>& color_out, std::vector<float>& variance_out) const;
+};
+
+#endif
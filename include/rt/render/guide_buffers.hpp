@@ -0,0 +1,47 @@
+#ifndef GUIDE_BUFFERS_H
+#define GUIDE_BUFFERS_H
+
+#include <span>
+#include <vector>
+#include "rt/render/accumulation.hpp"
+#include "rt/math/vec3.hpp"
+
+/**
+ * @struct GuideBuffers
+ * @brief Mean first-hit surface of every pixel of a traced image, which guides the Denoiser and the Upsampler.
+ *
+ * Both filters divide colors by the albedo (demodulate) so only the lighting is filtered, tell sky from surfaces
+ * by the length of the mean normal, and tolerate depth differences in proportion to the local depth gradient.
+ */
+struct GuideBuffers {
+    static constexpr float MIN_ALBEDO{0.01f};       // Colors are demodulated by at least this albedo
+    static constexpr float SKY_NORMAL_SQ{1e-4f};    // Squared mean normals below this are sky
+    static constexpr float SIGMA_DEPTH{1.f};        // Depth differences tolerated, in local depth gradients
+
+    /**
+     * @brief Averages the AOV sums of every pixel.
+     * @param width Image width in pixels.
+     * @param height Image height in pixels.
+     * @param pixels Sample sums of every pixel, including the AOV sums, row-major.
+     * @throws std::invalid_argument If pixels does not hold width * height pixels.
+     */
+    GuideBuffers(int width, int height, std::span<const PixelStats> pixels);
+
+    int width;
+    int height;
+    std::vector<Color> albedo;          // Mean albedo
+    std::vector<vec3> normal;           // Unit mean normal, zero for the sky and pixels without samples
+    std::vector<float> depth;           // Mean hit distance, zero for the sky
+    std::vector<float> depth_gradient;  // Largest depth change to a horizontal or vertical neighbour on the same surface
+
+    /** @return True if pixel i shows the sky (or has no samples). */
+    [[nodiscard]] bool sky(const std::size_t i) const noexcept { return normal[i].length_squared() == 0; }
+
+    /** @return Factors a color is divided by to demodulate it, and multiplied by again after filtering. */
+    [[nodiscard]] static Color demodulation(const Color& albedo);
+
+    /** @return Lighting of a color: the color divided by demodulation(albedo). */
+    [[nodiscard]] static Color demodulate(const Color& color, const Color& albedo);
+};
+
+#endif
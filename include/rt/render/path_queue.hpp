@@ -0,0 +1,71 @@
+#ifndef PATH_QUEUE_H
+#define PATH_QUEUE_H
+
+#include <cstdint>
+#include <vector>
+#include "rt/math/ray.hpp"
+#include "rt/math/vec3.hpp"
+
+/**
+ * @class PathQueue
+ * @brief Structure-of-arrays queue of path segments waiting for the same wavefront stage.
+ *
+ * Every entry is one ray of a path (origin, direction), the throughput the path carried up to that ray, and the
+ * index of the path it belongs to. Components live in separate arrays so a stage streams through only what it
+ * reads, and batches of rays can be handed to wide intersection kernels.
+ */
+class PathQueue {
+public:
+    /** @return Number of queued rays. */
+    [[nodiscard]] std::size_t size() const noexcept { return path_.size(); }
+
+    /** @return True if no ray is queued. */
+    [[nodiscard]] bool empty() const noexcept { return path_.empty(); }
+
+    /** @brief Removes every ray, keeping the allocations for the next batch. */
+    void clear() noexcept;
+
+    /** @brief Reserves room for count rays. */
+    void reserve(std::size_t count);
+
+    /**
+     * @brief Appends a ray.
+     * @param ray Next segment of the path.
+     * @param throughput Attenuation accumulated along the path before this ray.
+     * @param path Index of the path, for the radiance and pixel of the path.
+     */
+    void push(const Ray& ray, const Color& throughput, std::uint32_t path);
+
+    /** @return Queued ray i. */
+    [[nodiscard]] Ray ray(std::size_t i) const noexcept;
+
+    /** @return Throughput of the path before queued ray i. */
+    [[nodiscard]] Color throughput(std::size_t i) const noexcept { return {throughput_r_[i], throughput_g_[i], throughput_b_[i]}; }
+
+    /** @return Path queued ray i belongs to. */
+    [[nodiscard]] std::uint32_t path(std::size_t i) const noexcept { return path_[i]; }
+
+    /**
+     * @brief Reorders the queue so rays that are likely to visit the same BVH nodes are next to each other.
+     *
+     * Rays are grouped by the octant of their direction first, then by a Morton order of the grid cell their
+     * origin lies in, so that after a few diffuse bounces consecutive intersections still touch similar nodes.
+     * @param cell_size Edge length of the origin grid cells in world units.
+     */
+    void sort_coherent(float cell_size);
+
+private:
+    std::vector<float> origin_x_, origin_y_, origin_z_;
+    std::vector<float> direction_x_, direction_y_, direction_z_;
+    std::vector<float> throughput_r_, throughput_g_, throughput_b_;
+    std::vector<std::uint32_t> path_;
+
+    std::vector<std::uint64_t> order_;  // Sort keys with the queue index in the low bits, reused between sorts
+    std::vector<float> scratch_;        // Gather buffers for reordering one component array
+    std::vector<std::uint32_t> path_scratch_;
+
+    /** @brief Applies order_ to one component array. */
+    template<class T> void permute(std::vector<T>& values, std::vector<T>& scratch) const;
+};
+
+#endif
@@ -1,15 +1,60 @@
 #ifndef RENDER_H
 #define RENDER_H
 
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+#include "rt/render/accumulation.hpp"
 #include "rt/render/camera.hpp"
-class OpenSimplex2S;
+#include "rt/render/tile_scheduler.hpp"
+#include "rt/math/ray.hpp"
+#include "rt/render/upsampler.hpp"
+#include "rt/utilities.hpp"
+class FractalNoise;
 class HitRecord;
-class Ray;
 class Hittable;
 class HittableList;
+class Sphere;
 
 using std::function;
 
+/**
+ * @struct RenderSettings
+ * @brief How a Renderer splits up and schedules its work.
+ */
+struct RenderSettings {
+    int tile_size{16};          // Edge length of the square pixel tiles threads work on
+    bool pilot_pass{false};     // Time every tile at 1 spp first, then render the expensive tiles first
+    double time_budget{0};      // Seconds until no more tiles are started (after the first pass), 0 for no limit
+    double write_interval{0};   // Seconds between intermediate image writes, 0 to only write the final image
+    float adaptive_threshold{0};    // Relative error at which a pixel stops taking samples, 0 to sample every pixel equally
+    int min_samples{16};            // Samples every pixel takes before adaptive sampling may stop it
+    bool wavefront{false};      // Trace each tile's paths in bounce-synchronous batches instead of one path at a time
+    bool primary_packets{true}; // Trace the camera rays of 4x4 pixel blocks through the BVH as packets
+    bool light_sampling{true};  // Sample the lights at diffuse bounces (next-event estimation), MIS-weighted with the BSDF
+    Utilities::Sampler sampler{Utilities::Sampler::Owen};  // Source of the per-sample random values
+    std::uint64_t seed{0};      // Base of the per-sample random streams
+    double checkpoint_interval{0};  // Seconds between checkpoints of the accumulation buffer, 0 for none
+    bool resume{false};         // Continue from the last checkpoint instead of starting from zero samples
+    int worker{0};              // Index of this process in a distributed render
+    int num_workers{1};         // Processes sharing the frame, 1 to render it alone
+    bool split_tiles{false};    // Distribute whole tiles between workers instead of sample ranges
+    bool denoise{false};        // Filter the final image with the Denoiser, guided by the first-hit AOVs
+    bool write_aovs{false};     // Also write the first-hit albedo, normal and depth to albedo.ppm, normal.ppm and depth.ppm
+    std::string reference;      // Accumulation file of a converged render to report the final image's error against
+    int downscale{1};           // Path-trace at 1/downscale of the camera's resolution and upsample the final image to it
+    int crop_x{0};              // Window of camera pixels to render, the camera's whole image when crop_width is 0
+    int crop_y{0};
+    int crop_width{0};
+    int crop_height{0};
+    bool pad_crop{false};       // Write the window into a black image of the camera's size instead of on its own
+};
+
 /**
  * @class Renderer
  * @brief Encapsulates the overarching functions needed to produce a completed render file.
@@ -19,65 +64,350 @@ public:
     /**
      * @brief Constructs a Renderer which can generate a completed image of the world into an output .ppm file.
      * @param camera
+     * @param settings Tiling and scheduling of the render work.
      */
-    explicit Renderer(const Camera& camera) :
-        image_width_{camera.image_width()},
-        image_height_{camera.image_height()},
+    explicit Renderer(const Camera& camera, const RenderSettings& settings = {}) :
+        settings_{settings},
 
         // Center of first pixel (upper left) will be at the upperleft corner of viewport shifted halfway of a pixel delta
         pixel_0_center_{camera.viewport_upperleft_corner() + 0.5 * (camera.pixel_delta_u() + camera.pixel_delta_v())},
 
-        camera_(camera) {}
+        camera_(camera) {
+        if (settings_.crop_width <= 0 || settings_.crop_height <= 0) {
+            settings_.crop_x = settings_.crop_y = 0;
+            settings_.crop_width = camera.image_width();
+            settings_.crop_height = camera.image_height();
+        }
+
+        // Traced pixels (downscale x downscale camera pixels each) covering the window. Downscaled windows take the
+        // traced pixels the Upsampler interpolates from (and their neighbours, for the depth gradient) along, so their
+        // edges match the whole image
+        const int scale{settings_.downscale};
+        const int margin{scale > 1 ? Upsampler::TAPS / 2 + 1 : 0};
+        image_x0_ = std::max(0, settings_.crop_x / scale - margin);
+        image_y0_ = std::max(0, settings_.crop_y / scale - margin);
+        image_width_ = std::min((camera.image_width() + scale - 1) / scale,
+                                (settings_.crop_x + settings_.crop_width + scale - 1) / scale + margin) - image_x0_;
+        image_height_ = std::min((camera.image_height() + scale - 1) / scale,
+                                 (settings_.crop_y + settings_.crop_height + scale - 1) / scale + margin) - image_y0_;
+    }
+
+    /**
+     * @brief Registers a light for next-event estimation, it must also be part of the rendered world.
+     * @param light Emissive Sphere, sampled over the cone it covers from each diffuse hit.
+     */
+    void add_light(const std::shared_ptr<const Sphere>& light) { lights_.push_back(light); }
 
     /**
      * @brief Render visual output to a .ppm image file.
      *
-     * Sequentially generates a backward-tracing ray for each viewport pixel and coloring the results
-     * to a .ppm in P6 (binary) format.
+     * Generates backward-tracing rays for each viewport pixel, tile by tile on all worker threads, and writes
+     * the resulting colors to a .ppm in P6 (binary) format. With a pilot pass, its sample counts as the first
+     * of every pixel and the remaining ones are scheduled by the measured tile costs.
+     *
+     * With a time budget or write interval the render is progressive: passes of 1, 1, 2, 4, ... spp (doubling
+     * the total) accumulate into one buffer until the camera's sample count or the time budget is reached,
+     * each pass scheduled by the tile times of the one before.
+     *
+     * With an adaptive threshold, every pixel first takes the minimum number of samples and then keeps
+     * doubling them, in passes, until the relative standard error of its luminance drops to the threshold or
+     * it reaches the camera's sample count.
+     *
+     * At every diffuse bounce one registered light is sampled with a shadow ray (next-event estimation), and
+     * the light sample and the BSDF-sampled bounce are combined by multiple importance sampling (power heuristic).
+     *
+     * Every pixel also accumulates the albedo, normal and depth of its samples' first hits. They guide the
+     * Denoiser when it filters the final image, and can be written out as images of their own.
+     *
+     * With a downscale, paths are traced at that fraction of the camera's resolution (checkpoints, workers and
+     * intermediate images included) and only the final image is upsampled to it, see upsample().
+     *
+     * With a crop, only the pixels of that window are traced and written, optionally padded to the camera's whole
+     * image. Random streams are keyed by the pixel's position in the whole image, so the window's pixels come out
+     * the same as in a render of the whole image.
+     *
+     * With a checkpoint interval, the accumulated sums and sample counts are saved to image.checkpoint (via an
+     * atomic rename) periodically, at the end, and when SIGINT or SIGTERM stops the render early. Resuming loads
+     * that checkpoint and continues up to the camera's sample count.
+     *
+     * As one of several workers, only this worker's share of the frame is rendered (every worker-th tile, or its
+     * share of the camera's samples for every pixel, with its own random streams) and its sums are written to
+     * image.worker<index>.checkpoint instead of an image, for merge().
+     *
+     * The wavefront engine produces the same image (up to noise) with a different traversal order, see
+     * sample_tile_wavefront().
      * @param world All the Hittable objects to include in the render.
      */
     void render(const HittableList& world) const;
 
     /**
-     * @brief Render noise map to a .ppm image file.
+     * @brief Combines the accumulation files of the workers of a distributed render into image.ppm.
      *
-     * Sequentially shades a noise map for each pixel, where lighter grayscales represent higher noise output.
-     * @param simplex Noise to be mapped.
-     * @param freq Noise map frequency, increase to get more noise features per render.
+     * Sample sums are added per pixel, so each worker counts by the samples it took. The merged sums are also
+     * written to image.checkpoint, from which a single process can resume if they hold every pixel's samples from
+     * index 0 on without gaps, e.g. those of all workers once they finished.
+     * @param filenames Accumulation (worker or checkpoint) files of the same scene and resolution.
+     * @param settings Only the output settings (denoising, AOVs, reference) apply, crops are merged as they are.
+     * @throws std::invalid_argument If two files hold the same sample of a pixel, e.g. one file given twice.
      */
-    void render(const OpenSimplex2S &simplex, int freq) const;
+    static void merge(const std::vector<std::string>& filenames, const RenderSettings& settings = {});
+
+    /**
+     * @brief Reports how the path tracer scales over the threads of the shared ThreadPool.
+     *
+     * Traces the camera's samples of every pixel of the traced window (nothing is written) with 1, 2, 4, ... threads
+     * up to the pool's count, pinned if the pool is, and prints the time, samples per second, speedup and parallel
+     * efficiency of each. The pool keeps its full count afterwards.
+     * @param world All the Hittable objects to include in the render.
+     */
+    void measure_scaling(const HittableList& world) const;
+
+    /**
+     * @brief Render noise map to a noise.ppm image file.
+     *
+     * Shades a noise map where lighter grayscales represent higher noise output. The map is scheduled like
+     * the path tracer, in NoiseTileCache-aligned tiles which are evaluated with the batched FractalNoise::fill.
+     * @param noise Noise to be mapped (its octave settings apply).
+     * @param width Width of the noise map in pixels, independent of the camera resolution.
+     * @param height Height of the noise map in pixels.
+     * @param freq Noise map frequency (noise features across the width), increase to get more noise features per render.
+     */
+    void render(const FractalNoise& noise, int width, int height, float freq) const;
 
 private:
-    int image_width_;           // Number of rays to generate per row
+    int image_width_;           // Number of rays to generate per row (of the traced window, smaller than the camera's when downscaled or cropped)
     int image_height_;          // Number of ray to generate per column
+    int image_x0_;              // Position of the traced window in the whole traced image
+    int image_y0_;
+    RenderSettings settings_;   // Tiling and scheduling of the render work
     coord3 pixel_0_center_;     // Location of the first pixel (upperleft corner)
     Camera camera_;             // Renders will be created in the perspective of the camera
+    std::vector<std::shared_ptr<const Sphere>> lights_;     // Lights sampled by next-event estimation
+
+    /** @brief Consecutive sample indices of one pixel, which key the random streams of its paths. */
+    struct SampleRange {
+        int first{0};
+        int count{0};
+    };
 
     /**
-     * @brief For a specific pixel, calculates the color that should be written to the corresponding viewport pixel.
+     * @brief Traces the samples of a tile of the traced window with the engine the settings ask for.
+     * @param tile Pixels to trace, relative to the traced window.
+     * @param world All the Hittable objects to include in the render.
+     * @param samples Sample indices to trace per tile pixel, row-major.
+     * @param stats Receives the sums over the traced samples per tile pixel, row-major.
+     */
+    void sample_tile(const ImageTile& tile, const HittableList& world, std::span<const SampleRange> samples, std::span<PixelStats> stats) const;
+
+    /**
+     * @brief Traces samples through a specific pixel.
      * @param x Horizontal coordinate of the pixel.
      * @param y Vertical coordinate of the pixel.
      * @param world All the Hittable objects to include in the render.
-     * @return The color that should be written to the viewport pixel.
+     * @param samples Indices of the samples to trace.
+     * @return Sums over the traced samples.
+     */
+    [[nodiscard]] PixelStats sample_pixel(int x, int y, const HittableList& world, SampleRange samples) const;
+
+    /**
+     * @brief Traces the samples of a whole tile, with the camera rays of every 4x4 pixel block as one RayPacket.
+     *
+     * Each sample index of a block is intersected as a packet (lanes of pixels that need fewer samples, or lie
+     * outside the tile, are masked out), then every lane continues its path on its own.
+     * @param tile Pixels to trace.
+     * @param world All the Hittable objects to include in the render.
+     * @param samples Sample indices to trace per tile pixel, row-major.
+     * @param stats Receives the sums over the traced samples per tile pixel, row-major.
+     */
+    void sample_tile_packets(const ImageTile& tile, const HittableList& world, std::span<const SampleRange> samples, std::span<PixelStats> stats) const;
+
+    /**
+     * @brief Traces the samples of a whole tile as a wavefront instead of path by path.
+     *
+     * Paths advance one bounce at a time in batches of the tile's samples (tile_size² × spp paths, 2560 with the
+     * default 16 px tiles and 10 spp, split above 64K), each batch going through separate stages: generate
+     * (camera rays for every sample), extend (intersect the queued rays, sorted by direction octant and origin
+     * cell so consecutive BVH traversals are coherent), shade (shade_vertex() of every path, as in the depth-first
+     * engine, queueing the continuation rays and the shadow rays of light samples), and connect (trace the shadow
+     * rays). Finished paths are added to their pixels once the batch is empty.
+     * @param tile Pixels to trace.
+     * @param world All the Hittable objects to include in the render.
+     * @param samples Sample indices to trace per tile pixel, row-major.
+     * @param stats Receives the sums over the traced samples per tile pixel, row-major.
+     */
+    void sample_tile_wavefront(const ImageTile& tile, const HittableList& world, std::span<const SampleRange> samples, std::span<PixelStats> stats) const;
+
+    /**
+     * @brief Decides how many samples a pixel takes in a render pass.
+     * @param stats Samples of the pixel so far.
+     * @param target Samples this process takes for the pixel in total.
+     * @param pass Index of the render pass.
+     * @return Number of samples, 0 once the pixel is done.
+     */
+    [[nodiscard]] int pass_samples(const PixelStats& stats, int target, int pass) const;
+
+    /** @return Samples this process takes in total for every pixel, its share of the camera's samples. */
+    [[nodiscard]] std::vector<int> sample_targets() const;
+
+    /** @return Index of this process's first sample of every pixel, past the sample ranges of the workers before it. */
+    [[nodiscard]] int first_sample() const;
+
+    /** @brief Adds one sample color to a pixel's sums. */
+    static void add_sample(PixelStats& stats, const Color& color);
+
+    /**
+     * @brief Adds the first-hit surface of one sample to a pixel's AOV sums.
+     * @param stats Sums of the sample's pixel.
+     * @param camera_ray The sample's ray from the camera.
+     * @param camera_hit Closest hit of the camera ray, null if it escaped.
+     */
+    static void add_guides(PixelStats& stats, const Ray& camera_ray, const HitRecord* camera_hit);
+
+    /** @return Standard error of a pixel's mean luminance relative to the mean, infinite below 2 samples. */
+    [[nodiscard]] static float relative_error(const PixelStats& stats);
+
+    /**
+     * @brief Averages accumulated samples into pixel colors.
+     * @param pixels Sample sums of every pixel.
+     * @return Mean color of every pixel, black where nothing was sampled yet.
      */
-    [[nodiscard]] Color pixel_color(int x, int y, const HittableList& world) const;
+    [[nodiscard]] static std::vector<Color> resolve(std::span<const PixelStats> pixels);
 
     /**
-     * @brief Calculates the color of a specific ray.
-     * @param ray The ray in which coloring calculations will take place.
-     * @param depth Number of ray reflections until no more child rays can be generated.
+     * @brief Calculates the color of a specific camera ray, already intersected with the world, by following its path.
+     *
+     * Iterative: the path carries its throughput (product of the attenuations so far) and ends when it escapes,
+     * is absorbed, reaches the bounce limit, or is terminated by Russian roulette. Every vertex is shaded by shade_vertex().
+     * @param camera_ray The ray from the camera in which coloring calculations will take place.
+     * @param camera_hit Closest hit of the camera ray, null if it escaped.
      * @param world All the Hittable objects to include in the render.
+     * @param x Horizontal coordinate of the ray's pixel.
+     * @param y Vertical coordinate of the ray's pixel.
+     * @param sample Index of the sample within the pixel.
      * @return The color that should be factored into the color of the ray's viewport pixel.
      */
-    [[nodiscard]] Color ray_color(const Ray& ray, int depth, const Hittable& world) const;
+    [[nodiscard]] Color path_color(const Ray& camera_ray, const HitRecord* camera_hit, const Hittable& world, int x, int y, int sample) const;
+
+    /** @brief What a path carries from one vertex to the next, besides its throughput. */
+    struct PathState {
+        Color radiance{0, 0, 0};        // Light gathered so far
+        coord3 light_sample_point;      // Last hit, if it sampled the lights
+        float bsdf_pdf{0};              // Density of the bounce from that hit, 0 if it did not sample the lights
+    };
+
+    /** @brief Shadow ray of a light sample, whose contribution the path gains if nothing blocks it up to max_t. */
+    struct ShadowRay {
+        Ray ray;
+        float max_t;
+        Color contribution;
+    };
+
+    /**
+     * @brief Shades one vertex of a path, the step both render engines take at every bounce.
+     *
+     * A miss adds the sky (camera rays) or ambient light and ends the path. A hit adds its emission, MIS-weighted
+     * if the vertex before sampled the lights, then bounces off its material with the random stream of the
+     * sample's bounce, samples the lights if the bounce is diffuse and plays Russian roulette. Only the tracing of
+     * rays is left to the engine, so both produce the same paths.
+     * @param ray Ray that reached the vertex.
+     * @param hit Closest hit of the ray, null if it escaped.
+     * @param x Horizontal coordinate of the path's pixel in the traced image.
+     * @param y Vertical coordinate of the path's pixel in the traced image.
+     * @param sample Index of the sample within the pixel.
+     * @param bounce Number of bounces before ray, 0 for camera rays.
+     * @param path State of the path, gains the light added at this vertex.
+     * @param throughput Attenuation of the path before ray, updated to that before next.
+     * @param next Set to the continuation ray if the path goes on.
+     * @param shadow Set to the shadow ray of the light sample taken here, if any, reset otherwise.
+     * @return True if the path continues with next.
+     */
+    bool shade_vertex(const Ray& ray, const HitRecord* hit, int x, int y, int sample, int bounce, PathState& path, Color& throughput, Ray& next,
+                      std::optional<ShadowRay>& shadow) const;
+
+    /**
+     * @brief Samples the direct light reaching a diffuse hit from one randomly picked light.
+     *
+     * The shadow ray still has to be traced: the contribution only counts if nothing blocks it up to max_t.
+     * @param hit Diffuse surface hit.
+     * @param shadow_ray Set to the ray from the hit towards the sampled point of the light.
+     * @param max_t Set to the t just before the shadow ray reaches the light.
+     * @param contribution Set to the MIS-weighted diffuse light estimate, to be scaled by the path throughput.
+     * @return True if the light sample can contribute (faces the surface), false otherwise.
+     */
+    bool sample_light(const HitRecord& hit, Ray& shadow_ray, float& max_t, Color& contribution) const;
+
+    /** @return Solid angle density with which sample_light() picks a direction from a point. */
+    [[nodiscard]] float light_pdf(const coord3& from, const uvec3& direction) const;
+
+    /** @return Sky color seen by a camera ray that escapes the world. */
+    [[nodiscard]] static Color sky_color(const Ray& ray);
 
     /**
      * @brief Creates a ray directed at a random point centered around a specified pixel.
      * @param x Horizontal position of the pixel.
      * @param y Vertical position of the pixel.
+     * @param scale Camera pixels per pixel along each axis: settings' downscale for the traced image, 1 for the camera's.
      * @return Return a generated ray randomly sampled around the pixel location (i, j).
      */
-    [[nodiscard]] Ray generate_ray(int x, int y) const;
+    [[nodiscard]] Ray generate_ray(int x, int y, int scale) const;
+
+    /**
+     * @brief Reconstructs images traced at 1/downscale of the camera's resolution at the camera's, in the crop window.
+     *
+     * Traces as many camera rays per camera pixel as spp, up to MAX_GUIDE_SAMPLES, as packets and without paths.
+     * Rays that escape see the sky, every hit takes the lighting the Upsampler interpolates from the traced pixels
+     * on its surface times its own albedo, so silhouettes, the waterline and albedo edges are as sharp (and
+     * antialiased) as at full resolution.
+     * @param world All the Hittable objects to include in the render.
+     * @param pixels Sample sums of every traced pixel.
+     * @param images Colors of every traced pixel, replaced by the upsampled ones.
+     * @return First-hit sums of every camera pixel of the window (AOVs only, no colors).
+     */
+    [[nodiscard]] Accumulation upsample(const HittableList& world, std::span<const PixelStats> pixels,
+                                        std::vector<std::vector<Color>>& images) const;
+
+    /**
+     * @brief Runs work over every tile of an image on the workers of the shared ThreadPool while the calling thread logs progress.
+     *
+     * Tiles are handed out by a TileScheduler, so each worker covers compact regions of the image and steals
+     * leftover tiles from the others at the end.
+     * @param width Image width in pixels.
+     * @param height Image height in pixels.
+     * @param tile_size Tile edge length in pixels.
+     * @param work Processes one tile, tiles never overlap.
+     * @param tile_costs Estimated cost of each tile for longest-first scheduling, empty for Morton order.
+     * @param show_progress Draw a progress bar while waiting.
+     */
+    static void for_each_tile(int width, int height, int tile_size, const function<void(const ImageTile&)>& work,
+                              const std::vector<double>& tile_costs = {}, bool show_progress = true);
+
+    /**
+     * @brief Writes the final image.ppm of accumulated samples, denoised, upsampled, padded and with AOVs as the settings ask.
+     *
+     * With a reference, the RMSE of the displayed (gamma-corrected, clamped) colors against it is reported, for
+     * the noisy and the denoised image. A reference of the whole image is compared in the crop window only. The
+     * reference must hold other samples of the same seed than the image: shared ones are the same paths, which
+     * bias the error low (to zero at the reference's spp), so no error is reported then.
+     * @param width Image width in pixels.
+     * @param height Image height in pixels.
+     * @param pixels Sample sums of every pixel, row-major.
+     * @param first_sample Index of every pixel's first sample, Accumulation::GAPS if they have gaps.
+     * @param settings Output settings, the crop is the window of the whole image the final image covers, the seed
+     *                 is that of the image.
+     * @param frame_width Width of the whole image, which a padded crop is written into.
+     * @param frame_height Height of the whole image.
+     * @param upsample Replaces the (noisy and denoised) images by larger ones and returns their first-hit sums, empty to
+     *                 write the image as it was traced.
+     */
+    static void write_image(int width, int height, std::span<const PixelStats> pixels, int first_sample, const RenderSettings& settings,
+                            int frame_width, int frame_height, const function<Accumulation(std::vector<std::vector<Color>>&)>& upsample = {});
+
+    /**
+     * @brief Averages the first-hit sums of every pixel into AOV images.
+     * @param pixels Sums of every pixel.
+     * @return Mean albedo, normal (mapped from -1 to 1) and depth (linear grayscale up to the farthest hit) of every pixel.
+     */
+    [[nodiscard]] static std::array<std::vector<Color>, 3> aov_images(std::span<const PixelStats> pixels);
 
     /**
      * @brief Outputs all image pixel data to a ppm file.
@@ -86,6 +416,25 @@ private:
      * @param gamma Set to true for linear to gamma conversion.
      */
     void write_to_file(const std::string& filename, const std::vector<Color>& pixels, bool gamma) const;
+
+    /**
+     * @brief Outputs pixel colors of an image of any size to a ppm file.
+     * @param filename The name of the image file.
+     * @param width Image width in pixels.
+     * @param height Image height in pixels.
+     * @param pixels width * height colors, row-major.
+     * @param gamma Set to true for linear to gamma conversion.
+     */
+    static void write_to_file(const std::string& filename, int width, int height, const std::vector<Color>& pixels, bool gamma);
+
+    /**
+     * @brief Outputs already quantized RGB pixel data to a ppm file.
+     * @param filename The name of the image file.
+     * @param width Image width in pixels.
+     * @param height Image height in pixels.
+     * @param bytes width * height * 3 color channel bytes, row-major.
+     */
+    static void write_to_file(const std::string& filename, int width, int height, const std::vector<std::uint8_t>& bytes);
 };
 
 #endif
\ No newline at end of file
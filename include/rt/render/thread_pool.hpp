@@ -0,0 +1,110 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @class ThreadPool
+ * @brief Persistent worker threads that run one job at a time, each on every worker.
+ *
+ * Workers are started once and reused by every render, denoise and upsampling pass of the process, so their
+ * thread_local buffers (tile sums, wavefront queues) are allocated once and stay with them. Optionally each
+ * worker is pinned to its own CPU, before it allocates anything: on a multi-socket machine those buffers are then
+ * placed on its own NUMA node.
+ */
+class ThreadPool {
+public:
+    /**
+     * @brief Starts the workers.
+     * @param num_threads Number of workers, 0 for one per CPU this process may run on.
+     * @param pin Pin worker i to the i-th CPU this process may run on (wrapping around), where the OS supports it.
+     */
+    explicit ThreadPool(unsigned num_threads = 0, bool pin = false);
+
+    /** @brief Stops and joins the workers, after the job that is running. */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /** @return Number of workers. */
+    [[nodiscard]] unsigned size() const noexcept { return static_cast<unsigned>(threads_.size()); }
+
+    /** @return True if the workers are pinned to CPUs. */
+    [[nodiscard]] bool pinned() const noexcept { return pinned_; }
+
+    /**
+     * @brief Runs job on every worker and waits until all of them return.
+     * @param job Called once per worker with the worker's index, less than size(). Must not use the pool itself.
+     * @throws Whatever the job threw first, after all workers are done.
+     */
+    void run(const std::function<void(unsigned)>& job);
+
+    /**
+     * @brief Starts job on every worker without waiting, the caller must wait() for it before starting another.
+     * @param job Called once per worker with the worker's index, less than size(). Must not use the pool itself.
+     */
+    void start(const std::function<void(unsigned)>& job);
+
+    /**
+     * @brief Waits for the running job.
+     * @param timeout Longest time to wait.
+     * @return True if all workers returned (or no job is running), false on timeout.
+     * @throws Whatever the job threw first, once all workers are done.
+     */
+    [[nodiscard]] bool wait_for(std::chrono::milliseconds timeout);
+
+    /**
+     * @brief Waits until all workers returned from the running job.
+     * @throws Whatever the job threw first.
+     */
+    void wait();
+
+    /** @return The process's pool, started with all CPUs and no pinning unless configure() said otherwise. */
+    static ThreadPool& shared();
+
+    /**
+     * @brief Replaces the process's pool (if it differs), must not be called while it runs a job.
+     * @param num_threads Number of workers, 0 for one per CPU this process may run on.
+     * @param pin Pin the workers to CPUs.
+     */
+    static void configure(unsigned num_threads, bool pin);
+
+    /** @return Number of CPUs this process may run on (its affinity mask where the OS has one). */
+    [[nodiscard]] static unsigned available_cpus();
+
+private:
+    std::vector<std::jthread> threads_;
+    bool pinned_{false};
+
+    std::mutex mutex_;
+    std::condition_variable job_ready_;     // Workers wait for a new generation
+    std::condition_variable job_done_;      // The caller waits for busy_ to drop to 0
+    std::function<void(unsigned)> job_;
+    std::uint64_t generation_{0};           // Incremented by every job, workers run each generation once
+    unsigned busy_{0};                      // Workers that have not returned from the current job
+    std::exception_ptr error_;              // First exception thrown by the current job
+    bool stopping_{false};
+
+    /**
+     * @brief Loop of one worker, which runs every job once.
+     * @param index Index of the worker, passed to the jobs.
+     * @param cpu CPU to pin the worker to, -1 to leave it to the OS.
+     */
+    void work(unsigned index, int cpu);
+
+    /** @brief Rethrows the job's first exception, if any, and clears it. Called with mutex_ locked. */
+    void rethrow_error();
+
+    static std::unique_ptr<ThreadPool> shared_;
+};
+
+#endif
@@ -0,0 +1,74 @@
+#ifndef TILE_SCHEDULER_H
+#define TILE_SCHEDULER_H
+
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+/**
+ * @struct ImageTile
+ * @brief Rectangular block of image pixels, clipped to the image bounds.
+ */
+struct ImageTile {
+    int x0, y0;             // Upper left pixel
+    int width, height;
+    std::size_t index;      // Row-major position in the grid of tiles, indexes per-tile data such as costs
+};
+
+/**
+ * @class TileScheduler
+ * @brief Hands out the tiles of an image to worker threads, with work stealing.
+ *
+ * Tiles are ordered along a Morton (Z-order) curve and split into one contiguous run per worker, so each
+ * worker traces a compact 2D region of the image. Workers take tiles from the front of their own deque and,
+ * once it is empty, steal from the back of the others', which evens out the tail when some regions of the
+ * image are much more expensive than others.
+ *
+ * When per-tile costs are known (e.g. timed in a pilot pass) tiles are instead handed out in longest processing
+ * time (LPT) order: most expensive first, dealt round-robin over the workers, so the cheap tiles are left to fill
+ * the gaps at the end.
+ */
+class TileScheduler {
+public:
+    /**
+     * @brief Splits an image into tiles and distributes them over the worker deques.
+     * @param image_width Image width in pixels.
+     * @param image_height Image height in pixels.
+     * @param tile_size Tile edge length in pixels, tiles at the right and bottom edges are clipped.
+     * @param num_workers Number of worker deques.
+     * @param tile_costs Estimated cost of each tile by ImageTile::index for LPT ordering, empty for Morton order.
+     */
+    TileScheduler(int image_width, int image_height, int tile_size, unsigned num_workers, const std::vector<double>& tile_costs = {});
+
+    /** @return Number of tiles an image is split into, which is also the size of its per-tile data. */
+    [[nodiscard]] static std::size_t count_tiles(int image_width, int image_height, int tile_size) noexcept;
+
+    /**
+     * @brief Claims the next tile for a worker.
+     * @param worker Index of the calling worker, less than num_workers.
+     * @param steal Take tiles from the other workers once the worker's own deque is empty.
+     * @return A tile of the worker's own deque, a tile stolen from another worker, or nothing once all are claimed
+     * (or, without stealing, once the worker's own are).
+     */
+    [[nodiscard]] std::optional<ImageTile> next(unsigned worker, bool steal = true);
+
+    /** @return Total number of tiles. */
+    [[nodiscard]] std::size_t num_tiles() const noexcept { return num_tiles_; }
+
+private:
+    // Cache-line aligned so workers do not contend on each other's locks
+    struct alignas(64) WorkerQueue {
+        std::mutex mutex;
+        std::deque<ImageTile> tiles;
+    };
+
+    std::vector<WorkerQueue> queues_;
+    std::size_t num_tiles_;
+
+    /** @return Interleaved bits of x and y (Z-order curve index). */
+    [[nodiscard]] static std::uint64_t morton_code(std::uint32_t x, std::uint32_t y) noexcept;
+};
+
+#endif
@@ -0,0 +1,57 @@
+#ifndef UPSAMPLER_H
+#define UPSAMPLER_H
+
+#include <span>
+#include <vector>
+#include "rt/render/accumulation.hpp"
+#include "rt/render/guide_buffers.hpp"
+#include "rt/math/vec3.hpp"
+
+/**
+ * @class Upsampler
+ * @brief Joint bilateral upsampling of images path-traced at a fraction of the output resolution.
+ *
+ * Traced colors are divided by their albedo, and the lighting at a first hit of the output image is interpolated
+ * from the 4x4 traced pixels around it, weighted by distance and down where their normal or depth differs from
+ * the hit's. The caller multiplies it by the hit's own albedo, so silhouettes and albedo edges come from the
+ * output resolution and only the (smooth) lighting from the traced one.
+ */
+class Upsampler {
+public:
+    static constexpr int TAPS{4};   // Traced pixels along each axis a hit takes its lighting from
+
+    /**
+     * @brief Prepares the lighting and guides of traced images.
+     * @param width Traced image width in pixels.
+     * @param height Traced image height in pixels.
+     * @param x0 Horizontal position of the traced pixels in the whole traced image (of a crop).
+     * @param y0 Vertical position of the traced pixels in the whole traced image.
+     * @param scale Output pixels per traced pixel along each axis.
+     * @param pixels Sample sums of every traced pixel, including the AOV sums, row-major.
+     * @param images Colors of every traced pixel, one or more images (e.g. noisy and denoised) of the same samples.
+     * @throws std::invalid_argument If pixels or an image does not hold width * height pixels.
+     */
+    Upsampler(int width, int height, int x0, int y0, int scale, std::span<const PixelStats> pixels, const std::vector<std::vector<Color>>& images);
+
+    /**
+     * @brief Adds the upsampled color of one first hit of the output image, in every image.
+     * @param x Horizontal coordinate of the hit's pixel in the whole output image.
+     * @param y Vertical coordinate of the hit's pixel in the whole output image.
+     * @param albedo Albedo of the hit.
+     * @param normal Unit normal of the hit, facing the camera.
+     * @param depth Distance of the hit from the camera.
+     * @param colors Receives the color of the hit added to each image's.
+     */
+    void add_hit(int x, int y, const Color& albedo, const uvec3& normal, float depth, std::span<Color> colors) const;
+
+private:
+    int width_;
+    int height_;
+    int x0_;
+    int y0_;
+    int scale_;
+    GuideBuffers guides_;
+    std::vector<std::vector<Color>> lighting_;  // Colors of every image divided by the albedo
+};
+
+#endif
@@ -3,13 +3,108 @@
 
 #include "math/interval.hpp"
 #include <cstdint>
+#include <span>
 
 namespace Utilities {
-    /** @brief Seed the random value generator for when the random_float() functions are called. */
+    /** @brief Where the values of a path sample's random streams come from. */
+    enum class Sampler {
+        Independent,    // Hashed counter, every value independent
+        Sobol,          // Sobol points per dimension pair, index-shuffled and XOR-scrambled per pixel
+        Owen,           // Sobol points per dimension pair, index-shuffled and Owen-scrambled per pixel
+        BlueNoise       // Owen-scrambled Sobol points shared by all pixels, shifted per pixel by a screen-space dither
+    };
+
+    // Dimensions of a path vertex's stream (set_dimension()). 2D decisions start at an even dimension, so both of
+    // their values come from the same low-discrepancy pair
+    inline constexpr uint32_t DIMENSION_PIXEL{0};           // Camera vertex: jitter within the pixel (2)
+    inline constexpr uint32_t DIMENSION_LENS{2};            // Camera vertex: point on the defocus disk (2)
+    inline constexpr uint32_t DIMENSION_LOBE{0};            // Bounce vertex: reflect or refract, then specular or Fresnel (2)
+    inline constexpr uint32_t DIMENSION_DIRECTION{2};       // Bounce vertex: diffuse direction (2)
+    inline constexpr uint32_t DIMENSION_LIGHT{4};           // Bounce vertex: direction towards the sampled light (2)
+    inline constexpr uint32_t DIMENSION_LIGHT_SELECT{6};    // Bounce vertex: which light to sample
+    inline constexpr uint32_t DIMENSION_ROULETTE{7};        // Bounce vertex: Russian roulette
+
+    inline constexpr uint64_t GOLDEN_GAMMA{0x9e3779b97f4a7c15ULL};     // SplitMix64 increment
+
+    /** @brief SplitMix64 finalizer, a bijective 64-bit hash. */
+    constexpr uint64_t mix(uint64_t z) {
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        return z ^ (z >> 31);
+    }
+
+    /**
+     * @struct RandomStream
+     * @brief The stream random_float() draws from on one thread.
+     *
+     * Independent values are mix(key + (dimension + 1) * GOLDEN_GAMMA), i.e. a SplitMix64 sequence. The other
+     * samplers take the sample index and scramble their points by the pattern key, caching the work shared by
+     * the two dimensions of a pair.
+     */
+    struct RandomStream {
+        Sampler sampler{Sampler::Independent};
+        uint64_t key{mix(GOLDEN_GAMMA)};
+        uint64_t pattern_key{0};
+        uint32_t reversed_sample{0};    // Sample index with its bits reversed
+        uint32_t x{0};
+        uint32_t y{0};
+        uint64_t dimension{0};          // Next dimension to draw
+        uint64_t cached_pair{~0ULL};    // Dimension pair whose key and shuffled index are cached
+        uint64_t pair_key{0};
+        uint32_t pair_index{0};
+    };
+
+    // Defined once for the whole program, constant-initialized so accesses need no TLS wrapper call
+    constinit inline thread_local RandomStream random_stream{};
+
+    /**
+     * @brief Seed the random value generator for when the random_float() functions are called.
+     *
+     * Random values are a stateless hash of a stream key and a counter (one per thread), so a stream always
+     * yields the same values no matter which thread draws them or when. Seeded streams are always independent.
+     */
     void seed_random_generator(uint64_t seed);
 
+    /** @brief Selects the Sampler of the streams set by set_random_stream() on every thread from now on. */
+    void set_sampler(Sampler sampler);
+
+    /**
+     * @brief Points this thread's random_float() at the stream of one vertex of one path sample.
+     *
+     * Successive random_float() calls are the dimensions 0, 1, 2, ... of the stream keyed by all five values,
+     * which makes a render reproducible independent of threads, scheduling and how samples are split up.
+     * @param seed Render seed.
+     * @param x Horizontal image coordinate of the pixel.
+     * @param y Vertical image coordinate of the pixel.
+     * @param sample Index of the sample within the pixel.
+     * @param vertex Path vertex (0 for the camera ray, then one per bounce).
+     */
+    void set_random_stream(uint64_t seed, uint32_t x, uint32_t y, uint32_t sample, uint32_t vertex);
+
+    /** @brief Makes the next random_float() return the given dimension of the current stream. */
+    inline void set_dimension(const uint32_t dimension) {
+        random_stream.dimension = dimension;
+    }
+
+    /** @return Value of one dimension of the current stream from a low-discrepancy sampler. */
+    float low_discrepancy_float(uint64_t dimension);
+
     /** @return Random value between 0 and 1 from a continuous uniform distribution. */
-    float random_float();
+    inline float random_float() {
+        const uint64_t dimension{random_stream.dimension++};
+        if (random_stream.sampler != Sampler::Independent) {
+            return low_discrepancy_float(dimension);
+        }
+        // Top 24 bits, exactly representable, in [0, 1)
+        return static_cast<float>(mix(random_stream.key + (dimension + 1) * GOLDEN_GAMMA) >> 40) * 0x1p-24f;
+    }
+
+    /**
+     * @brief Fills values with the next dimensions of the current stream, the same values as that many random_float() calls.
+     *
+     * Independent streams are generated in a loop without dependencies between values, which vectorizes.
+     */
+    void fill(std::span<float> values);
 
     /** @return Random value between the bounds of the specified Interval range from a continuous uniform distribution. */
     float random_float(const Interval<float>& range);
@@ -18,4 +113,4 @@ namespace Utilities {
     float degrees_to_radians(float degrees);
 }
 
-#endif
\ No newline at end of file
+#endif
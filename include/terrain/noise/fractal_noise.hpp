@@ -0,0 +1,169 @@
+#ifndef FRACTAL_NOISE_H
+#define FRACTAL_NOISE_H
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <unordered_map>
+#include <vector>
+#include "terrain/noise/opensimplex2s.hpp"
+
+/** @brief How each octave's noise is shaped before being summed. */
+enum class FractalType {
+    Fbm,        // Plain fractal Brownian motion, sum of signed octaves
+    Ridged,     // (1 - |n|)^2 per octave, sharp crests
+    Billow      // |n| per octave, rounded puffy shapes
+};
+
+/**
+ * @struct FractalSettings
+ * @brief Parameters of a FractalNoise sum.
+ */
+struct FractalSettings {
+    FractalType type{FractalType::Fbm};
+    int octaves{1};             // Number of summed noise layers
+    float lacunarity{2.f};      // Frequency multiplier between consecutive octaves
+    float gain{0.5f};           // Amplitude multiplier between consecutive octaves
+};
+
+/**
+ * @class NoiseTileCache
+ * @brief Thread-safe cache of raw single-octave noise tiles, shared between FractalNoise instances.
+ *
+ * Tiles are keyed by (octave seed, sample spacing, tile coordinates), so filling the same grid again (e.g. when
+ * terrain is regenerated, or by another FractalNoise with an octave of the same seed) reuses the evaluated octaves.
+ * A grid of a different spacing, such as a finer level of detail, evaluates its own tiles.
+ */
+class NoiseTileCache {
+public:
+    static constexpr int TILE_SIZE{64};        // Samples per tile edge
+
+    /** @brief Identifies one evaluated tile of one octave. */
+    struct Key {
+        std::uint64_t seed;     // Seed of the octave's OpenSimplex2S, the fractal's seed plus the octave index
+        float spacing;          // Noise-space distance between neighbouring samples of this octave
+        int tile_x, tile_y;
+        bool gradient{false};   // Tile also holds the noise derivatives
+
+        bool operator==(const Key&) const = default;
+    };
+
+    // TILE_SIZE * TILE_SIZE samples, row-major, followed by the d/dx and d/dy planes for gradient keys
+    using Tile = std::vector<float>;
+
+    /**
+     * @brief Constructs an empty cache.
+     * @param max_tiles Number of tiles kept before the oldest are evicted (16 KB per tile).
+     */
+    explicit NoiseTileCache(const std::size_t max_tiles = 4096) : max_tiles_{max_tiles} {}
+
+    /**
+     * @brief Returns the cached tile for key, evaluating and inserting it first if missing.
+     * @param key Tile to look up.
+     * @param evaluate Fills a TILE_SIZE * TILE_SIZE tile (three planes of it for gradient keys) on a cache miss.
+     * @return Shared, immutable tile samples.
+     */
+    std::shared_ptr<const Tile> get(const Key& key, const std::function<void(Tile&)>& evaluate);
+
+    /** @brief Drops every cached tile. */
+    void clear();
+
+    /** @return Number of tiles currently cached. */
+    [[nodiscard]] std::size_t size() const;
+
+private:
+    struct KeyHash {
+        std::size_t operator()(const Key& key) const noexcept;
+    };
+
+    std::size_t max_tiles_;
+    mutable std::mutex mutex_;
+    std::unordered_map<Key, std::shared_ptr<const Tile>, KeyHash> tiles_;
+    std::deque<Key> insertion_order_;           // Oldest tiles are evicted first
+};
+
+/**
+ * @class FractalNoise
+ * @brief Multi-octave (fBm, ridged, billow) noise built on OpenSimplex2S, with octaves evaluated in cached tiles.
+ *
+ * Octave i uses its own OpenSimplex2S seeded with seed + i, at frequency lacunarity^i and amplitude gain^i.
+ * Results are normalized by the total amplitude so every FractalType stays within roughly -1 to 1.
+ */
+class FractalNoise {
+public:
+    /**
+     * @brief Constructs the per-octave noise generators.
+     * @param seed Seed of the first octave.
+     * @param settings Octave count, lacunarity, gain and shaping.
+     * @param cache Tile cache, can be shared between FractalNoise instances (a private one is created if null).
+     */
+    FractalNoise(std::uint64_t seed, const FractalSettings& settings, std::shared_ptr<NoiseTileCache> cache = nullptr);
+
+    /** @return Octave settings of this noise. */
+    [[nodiscard]] const FractalSettings& settings() const noexcept { return settings_; }
+
+    /** @return Tile cache used by fill(). */
+    [[nodiscard]] const std::shared_ptr<NoiseTileCache>& cache() const noexcept { return cache_; }
+
+    /**
+     * @brief Evaluates the fractal sum at a single point (uncached).
+     * @return Fractal noise value, roughly -1 to 1.
+     */
+    [[nodiscard]] float noise2(double x, double y) const;
+
+    /**
+     * @brief Evaluates the fractal sum and its analytic derivatives at a single point (uncached).
+     * @return Fractal noise value with its derivatives in x and y.
+     */
+    [[nodiscard]] OpenSimplex2S::Sample2 noise2_with_gradient(double x, double y) const;
+
+    /**
+     * @brief Fills a row-major grid of samples at noise coordinates ((x0 + i) * spacing, (y0 + j) * spacing).
+     *
+     * Each octave is summed from whole cached tiles, aligned to multiples of NoiseTileCache::TILE_SIZE samples.
+     * @param x0 Grid index of the first column.
+     * @param y0 Grid index of the first row.
+     * @param width Number of columns.
+     * @param height Number of rows.
+     * @param spacing Noise-space distance between neighbouring samples at the first octave.
+     * @param out Receives width * height samples.
+     */
+    void fill(int x0, int y0, int width, int height, float spacing, std::span<float> out) const;
+
+    /**
+     * @brief fill(), also writing the analytic derivatives of each sample.
+     *
+     * Derivatives are taken per grid step (with respect to i and j, not noise-space coordinates).
+     * @param out_dx Receives width * height derivatives along rows.
+     * @param out_dy Receives width * height derivatives along columns.
+     */
+    void fill_with_gradient(int x0, int y0, int width, int height, float spacing,
+                            std::span<float> out, std::span<float> out_dx, std::span<float> out_dy) const;
+
+private:
+    std::uint64_t seed_;
+    FractalSettings settings_;
+    std::vector<OpenSimplex2S> octaves_;
+    std::shared_ptr<NoiseTileCache> cache_;
+
+    /** @return Octave noise value after FractalType shaping. */
+    [[nodiscard]] float shape(float noise) const noexcept;
+
+    /** @return Derivative of shape() at noise, to chain octave derivatives through it. */
+    [[nodiscard]] float shape_slope(float noise) const noexcept;
+
+    /** @return Shaped, amplitude-weighted sum mapped to the -1 to 1 range. */
+    [[nodiscard]] float normalize(float sum, float total_amplitude) const noexcept;
+
+    /** @return Factor normalize() scales a sum by, which also applies to its derivatives. */
+    [[nodiscard]] float normalize_scale(float total_amplitude) const noexcept;
+
+    /** @brief Shared implementation of fill() and fill_with_gradient(), derivatives are skipped when out_dx is empty. */
+    void accumulate(int x0, int y0, int width, int height, float spacing,
+                    std::span<float> out, std::span<float> out_dx, std::span<float> out_dy) const;
+};
+
+#endif
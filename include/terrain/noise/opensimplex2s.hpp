@@ -1,13 +1,19 @@
 #ifndef OPENSIMPLEX2_H
 #define OPENSIMPLEX2_H
 
+#include <array>
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
+#include <memory>
+#include <mutex>
+#include <span>
 
 /**
  * @author K.jpg
  * Ported from https://github.com/KdotJPG/OpenSimplex2/blob/master/java/OpenSimplex2S.java
- * Probably not best implementation of static initialization.
- * Also changed some code to use fixed c-style arrays, to avoid using of std library.
+ * Lattice and gradient tables are generated at compile time (constexpr), so there is
+ * no static initialization and they live in shared read-only memory.
  */
 
 /**
@@ -24,6 +30,32 @@
  * documentation above each, for more info.
  */
 class OpenSimplex2S {
+public:
+    /**
+    * Precision of the per-instance gradient tables.
+    * Float halves their footprint (useful with many octaves/seeds alive at once),
+    * at the cost of float rounding in the result.
+    */
+    enum class Storage { Double, Float };
+
+    /**
+    * Noise value with its analytic partial derivatives,
+    * taken with respect to the input coordinates.
+    */
+    struct Sample2 {
+        double value {};
+        double dx {};
+        double dy {};
+    };
+
+    struct Sample3 {
+        double value {};
+        double dx {};
+        double dy {};
+        double dz {};
+    };
+
+private:
     struct Grad2 {
         double dx {};
         double dy {};
@@ -42,14 +74,67 @@ class OpenSimplex2S {
         double dw {};
     };
 
+    struct Grad3f {
+        float dx {};
+        float dy {};
+        float dz {};
+    };
+
+    struct Grad4f {
+        float dx {};
+        float dy {};
+        float dz {};
+        float dw {};
+    };
+
+    /**
+    * Per-instance table of N entries, built from perm on first use so that
+    * e.g. a 2D-only workload never allocates the 3D/4D tables.
+    * Safe to build from concurrent const calls. Copies start out unbuilt.
+    */
+    template <class T, std::size_t N>
+    class LazyTable {
+    public:
+        LazyTable() = default;
+        LazyTable(const LazyTable&) {}
+        LazyTable& operator=(const LazyTable&) { return *this; }
+
+        template <class Build>
+        const T* get(Build&& build) const {
+            if (const T* table = table_.load(std::memory_order_acquire)) {
+                return table;
+            }
+            std::scoped_lock lock {mutex_};
+            if (!storage_) {
+                storage_ = std::make_unique<T[]>(N);
+                build(storage_.get());
+                table_.store(storage_.get(), std::memory_order_release);
+            }
+            return storage_.get();
+        }
+
+        [[nodiscard]] std::size_t bytes() const {
+            return table_.load(std::memory_order_acquire) ? N * sizeof(T) : 0;
+        }
+
+    private:
+        mutable std::atomic<const T*> table_ {};
+        mutable std::unique_ptr<T[]> storage_;
+        mutable std::mutex mutex_;
+    };
+
     struct LatticePoint2D {
         int xsv {};
         int ysv {};
         double dx {};
         double dy {};
 
-        LatticePoint2D();
-        LatticePoint2D(int xsv, int ysv);
+        constexpr LatticePoint2D() = default;
+        constexpr LatticePoint2D(const int a_xsv, const int a_ysv) : xsv(a_xsv), ysv(a_ysv) {
+            const double ssv = (a_xsv + a_ysv) * -0.211324865405187;
+            dx = -a_xsv - ssv;
+            dy = -a_ysv - ssv;
+        }
     };
 
     struct LatticePoint3D {
@@ -59,10 +144,16 @@ class OpenSimplex2S {
         int xrv {};
         int yrv {};
         int zrv {};
-        LatticePoint3D* nextOnFailure {};
-        LatticePoint3D* nextOnSuccess {};
-        LatticePoint3D();
-        LatticePoint3D(int xrv, int yrv, int zrv, int lattice);
+        // Indices of the next point within the same octant's list, END terminates
+        signed char nextOnFailure {END};
+        signed char nextOnSuccess {END};
+
+        static constexpr signed char END = -1;
+
+        constexpr LatticePoint3D() = default;
+        constexpr LatticePoint3D(const int a_xrv, const int a_yrv, const int a_zrv, const int lattice) :
+            dxr(-a_xrv + lattice * 0.5), dyr(-a_yrv + lattice * 0.5), dzr(-a_zrv + lattice * 0.5),
+            xrv(a_xrv + lattice * 1024), yrv(a_yrv + lattice * 1024), zrv(a_zrv + lattice * 1024) {}
     };
 
     struct LatticePoint4D {
@@ -75,8 +166,15 @@ class OpenSimplex2S {
         double dz {};
         double dw {};
 
-        LatticePoint4D();
-        LatticePoint4D(int xsv, int ysv, int zsv, int wsv);
+        constexpr LatticePoint4D() = default;
+        constexpr LatticePoint4D(const int a_xsv, const int a_ysv, const int a_zsv, const int a_wsv) :
+            xsv(a_xsv), ysv(a_ysv), zsv(a_zsv), wsv(a_wsv) {
+            const double ssv = (a_xsv + a_ysv + a_zsv + a_wsv) * -0.138196601125011;
+            dx = -a_xsv - ssv;
+            dy = -a_ysv - ssv;
+            dz = -a_zsv - ssv;
+            dw = -a_wsv - ssv;
+        }
     };
 
     static constexpr int PSIZE = 2048;
@@ -86,20 +184,50 @@ class OpenSimplex2S {
     static constexpr double N3 = 0.2781926117527186;
     static constexpr double N4 = 0.11127401889945551;
 
-    static Grad2 GRADIENTS_2D[PSIZE];
-    static Grad3 GRADIENTS_3D[PSIZE];
-    static Grad4 GRADIENTS_4D[PSIZE];
-
-    static LatticePoint2D LOOKUP_2D[8 * 4];
-    static LatticePoint3D LOOKUP_3D[8];
-    static LatticePoint3D LOOKUP_3D_EXTRA[8][13];
-    static LatticePoint4D LOOKUP_4D[256][20];
-    static unsigned char LOOKUP_4D_SIZE[256];
-
-    short perm[PSIZE];
-    Grad2 permGrad2[PSIZE];
-    Grad3 permGrad3[PSIZE];
-    Grad4 permGrad4[PSIZE];
+    // Normalized gradient sets, a permutation value p selects GRADIENTS_xD[p % size].
+    // These and the lookups below are constexpr-generated in opensimplex2s.cpp
+    static const std::array<Grad2, 24> GRADIENTS_2D;
+    static const std::array<Grad3, 48> GRADIENTS_3D;
+    static const std::array<Grad4, 160> GRADIENTS_4D;
+
+    static const std::array<LatticePoint2D, 8 * 4> LOOKUP_2D;
+    static const std::array<std::array<LatticePoint3D, 14>, 8> LOOKUP_3D;    // Per octant, linked from [0]
+    static const std::array<std::array<LatticePoint4D, 20>, 256> LOOKUP_4D;
+    static const std::array<unsigned char, 256> LOOKUP_4D_SIZE;
+
+    // 32-bit so the batched kernels can gather it directly
+    alignas(64) int perm[PSIZE];
+    Storage storage;
+
+    // Only the tables for the selected Storage are ever built, except permGrad2f,
+    // which the float batch kernels use in both modes
+    LazyTable<Grad2, PSIZE> permGrad2;
+    LazyTable<float, 2 * PSIZE> permGrad2f;     // SoA: dx[PSIZE], then dy[PSIZE]
+    LazyTable<Grad3, PSIZE> permGrad3;
+    LazyTable<Grad3f, PSIZE> permGrad3f;
+    LazyTable<Grad4, PSIZE> permGrad4;
+    LazyTable<Grad4f, PSIZE> permGrad4f;
+
+    // Accessors that build the corresponding table on first use
+    [[nodiscard]] const Grad2* grad2Table() const;
+    [[nodiscard]] const float* grad2fTable() const;
+    [[nodiscard]] const Grad3* grad3Table() const;
+    [[nodiscard]] const Grad3f* grad3fTable() const;
+    [[nodiscard]] const Grad4* grad4Table() const;
+    [[nodiscard]] const Grad4f* grad4fTable() const;
+
+#if defined(__AVX512F__)
+    static constexpr std::size_t BATCH_WIDTH_F = 16;
+#elif defined(__AVX2__)
+    static constexpr std::size_t BATCH_WIDTH_F = 8;
+#else
+    static constexpr std::size_t BATCH_WIDTH_F = 1;
+#endif
+#if defined(__AVX2__)
+    static constexpr std::size_t BATCH_WIDTH_D = 4;
+#else
+    static constexpr std::size_t BATCH_WIDTH_D = 1;
+#endif
 
     /**
     * 2D SuperSimplex noise base.
@@ -107,6 +235,28 @@ class OpenSimplex2S {
     */
     [[nodiscard]] double noise2_Base(double xs, double ys) const;
 
+    /**
+    * noise2_Base, also returning the derivatives with respect to the
+    * unskewed lattice-space offsets (the dx, dy of each point contribution).
+    */
+    [[nodiscard]] Sample2 noise2_BaseGradient(double xs, double ys) const;
+
+    /**
+    * 2D SuperSimplex noise, standard lattice orientation, for exactly
+    * BATCH_WIDTH_F (float) or BATCH_WIDTH_D (double) points at once.
+    * Lattice points are selected arithmetically instead of through LOOKUP_2D,
+    * and gradients are fetched with hardware gathers.
+    * The float variant also writes the analytic derivatives when out_dx is non-null.
+    */
+    void noise2_Batch(const float* x, const float* y, float* out, float* out_dx = nullptr, float* out_dy = nullptr) const;
+    void noise2_Batch(const double* x, const double* y, double* out) const;
+
+    /**
+    * Shared implementation of noise2_Row and noise2_Row_with_gradient.
+    */
+    template <bool Gradient>
+    void noise2_RowImpl(double x0, double y, double step, float* out, float* out_dx, float* out_dy, std::size_t count) const;
+
     /**
     * Generate overlapping cubic lattices for 3D Re-oriented BCC noise.
     * Lookup table implementation inspired by DigitalShadow.
@@ -115,6 +265,11 @@ class OpenSimplex2S {
     */
     [[nodiscard]] double noise3_BCC(double xr, double yr, double zr) const;
 
+    /**
+    * noise3_BCC, also returning the derivatives with respect to (xr, yr, zr).
+    */
+    [[nodiscard]] Sample3 noise3_BCCGradient(double xr, double yr, double zr) const;
+
     /**
     * 4D SuperSimplex noise base.
     * Using ultra-simple 4x4x4x4 lookup partitioning.
@@ -125,22 +280,68 @@ class OpenSimplex2S {
 
     static int fastFloor(double x);
 
-    static void initLatticePoints();
-    static void initGradients();
-
-    struct Initializer {
-        Initializer();
-    };
-    static Initializer initializer;
-
 public:
-    explicit OpenSimplex2S(std::uint64_t seed = 0);
+    /**
+    * Only the permutation is built here, gradient tables are built lazily
+    * per dimension on the first noise call that needs them.
+    */
+    explicit OpenSimplex2S(std::uint64_t seed = 0, Storage storage = Storage::Double);
+
+    /**
+    * Bytes of permutation and gradient tables currently held by this instance.
+    */
+    [[nodiscard]] std::size_t tableBytes() const;
 
     /**
     * 2D SuperSimplex noise, standard lattice orientation (-1.0 - 1.0).
     */
     [[nodiscard]] double noise2(double x, double y) const;
 
+    /**
+    * 2D SuperSimplex noise, standard lattice orientation, over a batch of points.
+    * out[i] = noise2(xs[i], ys[i]) up to float rounding. Evaluates 16 (AVX-512)
+    * or 8 (AVX2) points per pass when compiled for those targets.
+    * All three spans must be the same length.
+    */
+    void noise2(std::span<const float> xs, std::span<const float> ys, std::span<float> out) const;
+
+    /**
+    * 2D SuperSimplex noise, standard lattice orientation, over a batch of points.
+    * Double precision variant, 4 points per pass with AVX2.
+    * All three spans must be the same length.
+    */
+    void noise2(std::span<const double> xs, std::span<const double> ys, std::span<double> out) const;
+
+    /**
+    * 2D SuperSimplex noise, standard lattice orientation, together with its
+    * analytic derivatives d/dx and d/dy from the same evaluation.
+    */
+    [[nodiscard]] Sample2 noise2_with_gradient(double x, double y) const;
+
+    /**
+    * noise2_with_gradient over a batch of points, vectorized like the
+    * batched noise2. All five spans must be the same length.
+    */
+    void noise2_with_gradient(std::span<const float> xs, std::span<const float> ys, std::span<float> out,
+                              std::span<float> out_dx, std::span<float> out_dy) const;
+
+    /**
+    * 2D SuperSimplex noise, standard lattice orientation, along a row of a regular grid:
+    * out[i] = noise2(x0 + i * step, y) up to float rounding.
+    * The fastest way to sample a grid on every build: with the AVX2/AVX-512 batch kernels the
+    * row goes through them, otherwise adjacent samples mostly share a lattice cell, so gradient
+    * lookups are done once per cell instead of per sample (about 2x the scalar noise2 at steps
+    * well below one cell).
+    */
+    void noise2_Row(double x0, double y, double step, std::span<float> out) const;
+
+    /**
+    * noise2_Row together with the analytic derivatives d/dx and d/dy of each sample.
+    * All three spans must be the same length.
+    */
+    void noise2_Row_with_gradient(double x0, double y, double step, std::span<float> out,
+                                  std::span<float> out_dx, std::span<float> out_dy) const;
+
     /**
     * 2D SuperSimplex noise, with Y pointing down the main diagonal.
     * Might be better for a 2D sandbox style game, where Y is vertical.
@@ -176,6 +377,14 @@ public:
     */
     [[nodiscard]] double noise3_XZBeforeY(double x, double y, double z) const;
 
+    /**
+    * noise3_Classic, noise3_XYBeforeZ and noise3_XZBeforeY, together with their
+    * analytic derivatives d/dx, d/dy and d/dz from the same evaluation.
+    */
+    [[nodiscard]] Sample3 noise3_Classic_with_gradient(double x, double y, double z) const;
+    [[nodiscard]] Sample3 noise3_XYBeforeZ_with_gradient(double x, double y, double z) const;
+    [[nodiscard]] Sample3 noise3_XZBeforeY_with_gradient(double x, double y, double z) const;
+
     /**
     * 4D SuperSimplex noise, classic lattice orientation.
     */
@@ -7,8 +7,9 @@
 #include "rt/geom/sphere.hpp"
 #include "rt/geom/triangle.hpp"
 #include "rt/render/render.hpp"
+#include "rt/render/thread_pool.hpp"
 #include "rt/geom/heightmap.hpp"
-#include "terrain/noise/opensimplex2s.hpp"
+#include "terrain/noise/fractal_noise.hpp"
 
 using std::make_shared;
 using std::shared_ptr;
@@ -19,10 +20,15 @@ int main(int argc, char* argv[]) {
     auto start{std::chrono::steady_clock::now()};
 
     int num_samples{};             // Increase for more samples = less noise but more compute
-    constexpr float aspect_ratio{16.f/9.f};
-    constexpr int image_height{1080};
 
     const run_arguments args{arg_parseopt(argc, argv)};
+    const float aspect_ratio{static_cast<float>(args.image_width) / static_cast<float>(args.image_height)};
+    const int image_height{args.image_height};
+    ThreadPool::configure(static_cast<unsigned>(args.threads), args.pin_threads);
+    if (args.merge) {
+        Renderer::merge(args.merge_inputs, RenderSettings{.denoise = args.denoise, .write_aovs = args.write_aovs, .reference = args.reference});
+        return 0;
+    }
     uint64_t seed{args.seed};
     num_samples = args.spp;
 
@@ -39,19 +45,53 @@ int main(int argc, char* argv[]) {
     };
     Utilities::seed_random_generator(seed);
     std::cout << "Seed: " << seed << std::endl;
+    std::cout << "Threads: " << ThreadPool::shared().size() << (ThreadPool::shared().pinned() ? ", pinned" : "") << std::endl;
 
     // Setup the world and 3d objects
-    const Renderer renderer{camera};
+    const RenderSettings render_settings{
+        args.tile_size,
+        args.pilot_pass,
+        args.time_budget,
+        args.write_interval,
+        args.adaptive_threshold,
+        args.min_spp,
+        args.wavefront,
+        args.primary_packets,
+        args.light_sampling,
+        args.sampler,
+        seed,
+        args.checkpoint_interval,
+        args.resume,
+        args.worker,
+        args.num_workers,
+        args.split_tiles,
+        args.denoise,
+        args.write_aovs,
+        args.reference,
+        args.downscale,
+        args.crop_x,
+        args.crop_y,
+        args.crop_width,
+        args.crop_height,
+        args.pad_crop
+    };
+    Renderer renderer{camera, render_settings};
     HittableList world;
 
     Material light {Material::create_light(Color{1.0, 0.6, 0.5}, Emittance{100.0})};
-    world.add(make_shared<Sphere>(coord3{0, 1.1, -10}, Radius{1.5}, light));
+    const auto sun{make_shared<Sphere>(coord3{0, 1.1, -10}, Radius{1.5}, light)};
+    world.add(sun);
+    renderer.add_light(sun);
 
     // Noise generation for terrain
-    const OpenSimplex2S simplex{seed};
+    const FractalNoise terrain_noise{seed, args.fractal};
+    constexpr float noise_img_freq{5};
+    if (args.preview_width > 0) {
+        renderer.render(terrain_noise, args.preview_width, args.preview_height, noise_img_freq);
+        return 0;
+    }
     #ifndef NDEBUG
-    constexpr int noise_img_freq{5};
-    renderer.render(simplex, noise_img_freq);
+    renderer.render(terrain_noise, camera.image_width(), camera.image_height(), noise_img_freq);
     #endif
 
     // Ground (center visible ground around camera)
@@ -64,7 +104,8 @@ int main(int argc, char* argv[]) {
     constexpr coord3 corner{static_cast<float>(-coord_length), 0, 0};
     const int norm{std::min(length, width)};
     Heightmap map{
-        [&](const double x, const double y){ return simplex.noise2(x * freq / norm, y * freq / norm); },
+        terrain_noise,
+        static_cast<float>(freq) / static_cast<float>(norm),
         corner,
         grid_square_length,
         length,
@@ -97,6 +138,10 @@ int main(int argc, char* argv[]) {
     std::cout << "Setup time: " << duration.count() << " ms" << std::endl;
     #endif
 
+    if (args.scaling) {
+        renderer.measure_scaling(world);
+        return 0;
+    }
     renderer.render(world);
 
     auto end{std::chrono::steady_clock::now()};
@@ -1,4 +1,6 @@
 #include "rt/geom/aabb.hpp"
+
+#include <algorithm>
 #include "rt/math/ray.hpp"
 
 bool Aabb::ray_hit(const Ray& ray, Interval<float> t) const {
@@ -20,4 +22,25 @@ bool Aabb::ray_hit(const Ray& ray, Interval<float> t) const {
         }
     }
     return true;
-}
\ No newline at end of file
+}
+
+RayPacket::Mask Aabb::packet_hit(const RayPacket& packet, const RayPacket::Mask active, const float t_min,
+                                 const std::array<float, RayPacket::SIZE>& t_max) const {
+    // Same slab test as ray_hit(), branchless over all lanes so it compiles to SIMD min/max
+    const auto slab = [](const Interval<float>& bounds, const float origin, const float inverse, float& near, float& far) {
+        const float t0{(bounds.min() - origin) * inverse};
+        const float t1{(bounds.max() - origin) * inverse};
+        near = std::max(near, std::min(t0, t1));
+        far = std::min(far, std::max(t0, t1));
+    };
+    RayPacket::Mask hits{0};
+    for (int lane = 0; lane < RayPacket::SIZE; lane++) {
+        float near{t_min};
+        float far{t_max[lane]};
+        slab(x_, packet.origin_x[lane], packet.inverse_x[lane], near, far);
+        slab(y_, packet.origin_y[lane], packet.inverse_y[lane], near, far);
+        slab(z_, packet.origin_z[lane], packet.inverse_z[lane], near, far);
+        hits |= static_cast<RayPacket::Mask>(near < far) << lane;
+    }
+    return hits & active;
+}
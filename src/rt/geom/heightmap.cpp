@@ -1,10 +1,71 @@
 #include "rt/geom/heightmap.hpp"
 
+#include <algorithm>
 #include "rt/utilities.hpp"
 #include "rt/geom/triangle.hpp"
+#include "terrain/noise/fractal_noise.hpp"
+#include "terrain/noise/opensimplex2s.hpp"
 
 using std::make_shared;
 
+Heightmap::Heightmap(
+    const OpenSimplex2S& noise,
+    const float frequency,
+    const coord3& corner,
+    const float grid_square_length,
+    const int length,
+    const int width
+    ) :
+    corner_{corner},
+    grid_square_len_{grid_square_length},
+    length_{std::max(1, length)},
+    width_{std::max(1, width)} {
+    vertices_heights_.resize(length_ * width_);
+    vertices_normals_.resize(length_ * width_);
+
+    // One grid row of noise at a time
+    std::vector<float> dxs(width_);
+    std::vector<float> dzs(width_);
+    for (int z = 0; z < length_; z++) {
+        const size_t row_start{static_cast<size_t>(z) * width_};
+        const std::span row{vertices_heights_.data() + row_start, static_cast<size_t>(width_)};
+        noise.noise2_Row_with_gradient(0, static_cast<double>(z) * frequency, frequency, row, dxs, dzs);
+        for (int x = 0; x < width_; x++) {
+            row[x] += corner_.y();
+            // Noise derivatives are per noise-space unit, one grid square spans frequency of those
+            vertices_normals_[row_start + x] = normal_from_slope(dxs[x] * frequency, dzs[x] * frequency);
+        }
+    }
+}
+
+Heightmap::Heightmap(
+    const FractalNoise& noise,
+    const float frequency,
+    const coord3& corner,
+    const float grid_square_length,
+    const int length,
+    const int width
+    ) :
+    corner_{corner},
+    grid_square_len_{grid_square_length},
+    length_{std::max(1, length)},
+    width_{std::max(1, width)} {
+    vertices_heights_.resize(length_ * width_);
+    vertices_normals_.resize(length_ * width_);
+    std::vector<float> dxs(vertices_heights_.size());
+    std::vector<float> dzs(vertices_heights_.size());
+    noise.fill_with_gradient(0, 0, width_, length_, frequency, vertices_heights_, dxs, dzs);
+    for (size_t vertex = 0; vertex < vertices_heights_.size(); vertex++) {
+        vertices_heights_[vertex] += corner_.y();
+        vertices_normals_[vertex] = normal_from_slope(dxs[vertex], dzs[vertex]);
+    }
+}
+
+uvec3 Heightmap::normal_from_slope(const float dx, const float dz) const {
+    // Surface y = h(x, z) has normal (-dh/dx, 1, -dh/dz), with the slopes converted from grid squares to world units
+    return unit(vec3{-dx / grid_square_len_, 1.f, -dz / grid_square_len_});
+}
+
 // For each quad (square of vertices), construct two triangles
 std::vector<shared_ptr<Triangle>> Heightmap::construct_map() const {
     std::vector<shared_ptr<Triangle>> triangles;
@@ -39,10 +100,18 @@ std::vector<shared_ptr<Triangle>> Heightmap::construct_map() const {
                     Reflectance{1.0},
                     Shininess{0.0}
                 )};
-            Triangle upper_left{up_left, up_right, low_left, material1};
-            Triangle lower_right{up_right, low_left, low_right, material2};
-            triangles.push_back(make_shared<Triangle>(upper_left));
-            triangles.push_back(make_shared<Triangle>(lower_right));
+            if (vertices_normals_.empty()) {
+                triangles.push_back(make_shared<Triangle>(up_left, up_right, low_left, material1));
+                triangles.push_back(make_shared<Triangle>(up_right, low_left, low_right, material2));
+            } else {
+                // Smooth shading from the analytic vertex normals
+                const uvec3& n_up_left{vertices_normals_[vertex]};
+                const uvec3& n_up_right{vertices_normals_[vertex + 1]};
+                const uvec3& n_low_left{vertices_normals_[vertex + width_]};
+                const uvec3& n_low_right{vertices_normals_[vertex + width_ + 1]};
+                triangles.push_back(make_shared<Triangle>(up_left, up_right, low_left, n_up_left, n_up_right, n_low_left, material1));
+                triangles.push_back(make_shared<Triangle>(up_right, low_left, low_right, n_up_right, n_low_left, n_low_right, material2));
+            }
             vertex++;
         }
         vertex++;
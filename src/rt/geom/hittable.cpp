@@ -19,6 +19,13 @@ bool HitRecord::set_face_normal(const Ray& ray, const uvec3& normal) {
 }
 
 bool HitRecord::bounce(const Ray& ray, Color &attenuation, Ray &next) const {
+    bool diffuse;
+    return bounce(ray, attenuation, next, diffuse);
+}
+
+bool HitRecord::bounce(const Ray& ray, Color &attenuation, Ray &next, bool& diffuse) const {
+    diffuse = false;
+    Utilities::set_dimension(Utilities::DIMENSION_LOBE);
     const float random{Utilities::random_float()};
     uvec3 n{normal_};
     if (!front_face_) {
@@ -33,8 +40,10 @@ bool HitRecord::bounce(const Ray& ray, Color &attenuation, Ray &next) const {
             attenuation = material_.albedo();
         } else {
             // Diffuse scattering
+            Utilities::set_dimension(Utilities::DIMENSION_DIRECTION);
             next = Ray{point_, scatter_uvec3(n)};
             attenuation = material_.albedo();
+            diffuse = true;
         }
         return true;
     }
@@ -62,3 +71,15 @@ bool HitRecord::bounce(const Ray& ray, Color &attenuation, Ray &next) const {
 Color HitRecord::emitted() const {
     return material_.albedo() * material_.emittance();
 }
+
+RayPacket::Mask Hittable::packet_hit(const RayPacket& packet, const RayPacket::Mask active, const float t_min,
+                                     std::array<float, RayPacket::SIZE>& t_max, std::array<HitRecord, RayPacket::SIZE>& hit_records) const {
+    RayPacket::Mask hits{0};
+    for (int lane = 0; lane < RayPacket::SIZE; lane++) {
+        if ((active >> lane & 1) && ray_hit(packet.rays[lane], Interval{t_min, t_max[lane]}, hit_records[lane])) {
+            t_max[lane] = hit_records[lane].t();
+            hits |= RayPacket::Mask{1} << lane;
+        }
+    }
+    return hits;
+}
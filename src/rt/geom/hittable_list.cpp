@@ -1,5 +1,7 @@
 #include "rt/geom/hittable_list.hpp"
 
+#include <algorithm>
+
 // Add object to vector of objects, then add it's bounding box to list's bounding box
 void HittableList::add(const shared_ptr<Hittable>& object) {
     objects_.push_back(object);
@@ -19,4 +21,17 @@ bool HittableList::ray_hit(const Ray& ray, const Interval<float>& t, HitRecord&
         }
     }
     return anything_hit;
-}
\ No newline at end of file
+}
+
+bool HittableList::occluded(const Ray& ray, const Interval<float>& t) const {
+    return std::ranges::any_of(objects_, [&](const shared_ptr<Hittable>& object) { return object->occluded(ray, t); });
+}
+
+RayPacket::Mask HittableList::packet_hit(const RayPacket& packet, const RayPacket::Mask active, const float t_min,
+                                         std::array<float, RayPacket::SIZE>& t_max, std::array<HitRecord, RayPacket::SIZE>& hit_records) const {
+    RayPacket::Mask hits{0};
+    for (const shared_ptr<Hittable>& object : objects_) {
+        hits |= object->packet_hit(packet, active, t_min, t_max, hit_records);
+    }
+    return hits;
+}
@@ -1,8 +1,28 @@
 #include "rt/geom/sphere.hpp"
 #include "rt/math/ray.hpp"
 #include "rt/geom/aabb.hpp"
+#include "rt/utilities.hpp"
 
 bool Sphere::ray_hit(const Ray& ray, const Interval<float>& t, HitRecord& hit_record) const {
+    float calculated_t;
+    if (!intersect(ray, t, calculated_t)) {
+        return false;
+    }
+
+    // Initialize all HitRecord fields before returning
+    hit_record.point(ray.position(calculated_t));
+    hit_record.t(calculated_t);
+    hit_record.set_face_normal(ray, unit(hit_record.point() - center_));
+    hit_record.material(material_);
+    return true;
+}
+
+bool Sphere::occluded(const Ray& ray, const Interval<float>& t) const {
+    float calculated_t;
+    return intersect(ray, t, calculated_t);
+}
+
+bool Sphere::intersect(const Ray& ray, const Interval<float>& t, float& ray_t) const {
     const float a{ray.direction().length_squared()};
     const float b{dot(nounit(ray.direction()), center_ - ray.origin())};
     const float c{(center_ - ray.origin()).length_squared() - radius_ * radius_};
@@ -12,18 +32,49 @@ bool Sphere::ray_hit(const Ray& ray, const Interval<float>& t, HitRecord& hit_re
     }
 
     // Up to 2 possible intersections, pick the one with smallest t-value
-    float calculated_t{(b - std::sqrt(det)) / a};
-    if (calculated_t < t.min() || calculated_t > t.max()) {
-        calculated_t = (b + std::sqrt(det)) / a;
-        if (calculated_t < t.min() || calculated_t > t.max()) {
+    ray_t = (b - std::sqrt(det)) / a;
+    if (ray_t < t.min() || ray_t > t.max()) {
+        ray_t = (b + std::sqrt(det)) / a;
+        if (ray_t < t.min() || ray_t > t.max()) {
             return false;
         }
     }
-
-    // Initialize all HitRecord fields before returning
-    hit_record.point(ray.position(calculated_t));
-    hit_record.t(calculated_t);
-    hit_record.set_face_normal(ray, unit(hit_record.point() - center_));
-    hit_record.material(material_);
     return true;
-}
\ No newline at end of file
+}
+
+uvec3 Sphere::sample_cone(const coord3& from, float& pdf) const {
+    const coord3 to_center{center_ - from};
+    const float distance_squared{to_center.length_squared()};
+    if (distance_squared <= radius_ * radius_) {
+        pdf = 0;
+        return uvec3{0, 1, 0};
+    }
+
+    // Uniform in cos(theta) between the cone's edge and its axis is uniform over the cone's solid angle
+    const float cos_max{std::sqrt(1.f - radius_ * radius_ / distance_squared)};
+    const float cos_theta{1.f - Utilities::random_float() * (1.f - cos_max)};
+    const float sin_theta{std::sqrt(std::max(0.f, 1.f - cos_theta * cos_theta))};
+    const float phi{2.f * static_cast<float>(M_PI) * Utilities::random_float()};
+
+    // Orthonormal basis around the cone axis
+    const uvec3 w{unit(to_center)};
+    const uvec3 a{(std::fabs(w.x()) > 0.9f) ? uvec3{0,1,0} : uvec3{1,0,0}};
+    const uvec3 v{unit(cross(w, a))};
+    const uvec3 u{unit(cross(v, w))};
+
+    pdf = 1.f / (2.f * static_cast<float>(M_PI) * (1.f - cos_max));
+    return unit(u * (std::cos(phi) * sin_theta) + v * (std::sin(phi) * sin_theta) + w * cos_theta);
+}
+
+float Sphere::cone_pdf(const coord3& from, const uvec3& direction) const {
+    const coord3 to_center{center_ - from};
+    const float distance_squared{to_center.length_squared()};
+    if (distance_squared <= radius_ * radius_) {
+        return 0;
+    }
+    const float cos_max{std::sqrt(1.f - radius_ * radius_ / distance_squared)};
+    if (dot(direction, unit(to_center)) < cos_max) {
+        return 0;
+    }
+    return 1.f / (2.f * static_cast<float>(M_PI) * (1.f - cos_max));
+}
@@ -2,6 +2,30 @@
 #include "rt/math/ray.hpp"
 
 bool Triangle::ray_hit(const Ray& ray, const Interval<float>& t, HitRecord& hit_record) const {
+    float ray_t, u, v;
+    if (!intersect(ray, t, ray_t, u, v)) {
+        return false;
+    }
+
+    // Initialize all HitRecord fields before returning
+    hit_record.point(ray.position(ray_t));
+    hit_record.t(ray_t);
+    if (smooth_) {
+        // Barycentric interpolation of the vertex normals (u weights b, v weights c)
+        hit_record.set_face_normal(ray, unit((1.f - u - v) * vertex_normals_[0] + u * vertex_normals_[1] + v * vertex_normals_[2]));
+    } else {
+        hit_record.set_face_normal(ray, normal_);
+    }
+    hit_record.material(material_);
+    return true;
+}
+
+bool Triangle::occluded(const Ray& ray, const Interval<float>& t) const {
+    float ray_t, u, v;
+    return intersect(ray, t, ray_t, u, v);
+}
+
+bool Triangle::intersect(const Ray& ray, const Interval<float>& t, float& ray_t, float& u, float& v) const {
     const vec3 ray_cross_ac{cross(nounit(ray.direction()), ac_)};
     const float det{dot(ab_, ray_cross_ac)};
 
@@ -13,23 +37,16 @@ bool Triangle::ray_hit(const Ray& ray, const Interval<float>& t, HitRecord& hit_
     const float inv_det{1.f / det};
     const vec3 r{ray.origin() - a_};
 
-    const float u{inv_det * dot(r, ray_cross_ac)};
+    u = inv_det * dot(r, ray_cross_ac);
     if (constexpr Interval interval{0.f, 1.f}; !interval.inclusive_contains(u, 1e-6)) {
         return false;
     }
     const vec3 r_cross_ab{cross(r, ab_)};
-    if (const float v{inv_det * dot(ray.direction(), r_cross_ab)}; v < -1e-6 || u + v > 1 + 1e-6) {
+    v = inv_det * dot(ray.direction(), r_cross_ab);
+    if (v < -1e-6 || u + v > 1 + 1e-6) {
         return false;
     }
 
-    const float ray_t{inv_det * dot(ac_, r_cross_ab)};
-    if (!t.inclusive_contains(ray_t, 1e-4)) {
-        return false;
-    }
-    // Initialize all HitRecord fields before returning
-    hit_record.point(ray.position(ray_t));
-    hit_record.t(ray_t);
-    hit_record.set_face_normal(ray, normal_);
-    hit_record.material(material_);
-    return true;
+    ray_t = inv_det * dot(ac_, r_cross_ab);
+    return t.inclusive_contains(ray_t, 1e-4);
 }
\ No newline at end of file
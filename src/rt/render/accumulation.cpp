@@ -0,0 +1,128 @@
+#include "rt/render/accumulation.hpp"
+
+#include <algorithm>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <optional>
+#include <stdexcept>
+
+static constexpr std::uint32_t ACCUMULATION_MAGIC{0x33435452};      // "RTC3", older headers had no crop position ("RTCK") or first sample ("RTC2")
+
+// Fixed-size header in front of the raw pixel sums of an accumulation file
+struct AccumulationHeader {
+    std::uint32_t magic;
+    std::uint32_t pixel_size;   // sizeof(PixelStats), rejects files of a different build
+    int width, height;
+    std::uint64_t seed;
+    int passes;
+    int x0, y0;
+    int first_sample;
+};
+
+void Accumulation::write(const std::string& filename) const {
+    const AccumulationHeader header{ACCUMULATION_MAGIC, static_cast<std::uint32_t>(sizeof(PixelStats)), width, height, seed, passes, x0, y0, first_sample};
+    const std::string part{filename + ".part"};
+    {
+        std::ofstream out{part, std::ios_base::binary};
+        if (!out) {
+            const std::error_code error{errno, std::generic_category()};
+            throw std::runtime_error("Failed to open accumulation file: " + part + " (" + error.message() + ")");
+        }
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(reinterpret_cast<const char*>(pixels.data()), static_cast<std::streamsize>(pixels.size() * sizeof(PixelStats)));
+        out.close();    // Flushes, so a full disk is caught here
+        if (!out) {
+            throw std::runtime_error("Failed to write accumulation file: " + part);
+        }
+    }
+    std::filesystem::rename(part, filename);
+}
+
+Accumulation Accumulation::read(const std::string& filename) {
+    std::ifstream in{filename, std::ios_base::binary};
+    if (!in) {
+        const std::error_code error{errno, std::generic_category()};
+        throw std::runtime_error("Failed to open accumulation file: " + filename + " (" + error.message() + ")");
+    }
+    AccumulationHeader header{};
+    in.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!in || header.magic != ACCUMULATION_MAGIC || header.pixel_size != sizeof(PixelStats) || header.width <= 0 || header.height <= 0) {
+        throw std::runtime_error("Not an accumulation file of this renderer: " + filename);
+    }
+
+    Accumulation accumulation{header.width, header.height, header.seed, header.passes,
+                              std::vector<PixelStats>(static_cast<std::size_t>(header.width) * header.height), header.x0, header.y0,
+                              header.first_sample};
+    in.read(reinterpret_cast<char*>(accumulation.pixels.data()), static_cast<std::streamsize>(accumulation.pixels.size() * sizeof(PixelStats)));
+    if (!in) {
+        throw std::runtime_error("Truncated accumulation file: " + filename);
+    }
+    return accumulation;
+}
+
+Accumulation Accumulation::merge(const std::vector<Accumulation>& parts) {
+    if (parts.empty()) {
+        throw std::invalid_argument("Nothing to merge");
+    }
+    const Accumulation& first{parts.front()};
+    for (const Accumulation& part : parts) {
+        if (part.width != first.width || part.height != first.height || part.x0 != first.x0 || part.y0 != first.y0 || part.seed != first.seed) {
+            throw std::invalid_argument(std::format("Cannot merge a {}x{}+{}+{} render with seed {} into a {}x{}+{}+{} render with seed {}",
+                                                    part.width, part.height, part.x0, part.y0, part.seed,
+                                                    first.width, first.height, first.x0, first.y0, first.seed));
+        }
+    }
+
+    // Per pixel, the sample ranges of the parts that have any, in index order, must not overlap. They join up if
+    // each starts where the one before ends, and the result is one range if all pixels start at the same index
+    Accumulation merged{first.width, first.height, first.seed, 0, std::vector<PixelStats>(first.pixels.size()), first.x0, first.y0, first.first_sample};
+    std::optional<int> start;
+    bool gaps{false};
+    std::vector<std::pair<int, std::size_t>> ranges;    // First sample and part of every part with samples of the pixel
+    for (std::size_t i = 0; i < merged.pixels.size(); i++) {
+        ranges.clear();
+        for (std::size_t part = 0; part < parts.size(); part++) {
+            if (parts[part].pixels[i].samples > 0) {
+                ranges.emplace_back(parts[part].first_sample, part);
+            }
+        }
+        std::ranges::sort(ranges);
+        for (std::size_t range = 0; range < ranges.size(); range++) {
+            const auto [begin, part]{ranges[range]};
+            merged.pixels[i].add(parts[part].pixels[i]);
+            if (range == 0) {
+                gaps = gaps || begin == GAPS || (start && *start != begin);
+                start = begin;
+                continue;
+            }
+            const auto [previous_begin, previous_part]{ranges[range - 1]};
+            const int previous_end{previous_begin + parts[previous_part].pixels[i].samples};
+            if (previous_begin == GAPS || previous_end > begin) {
+                throw std::invalid_argument(std::format("Merge inputs {} and {} {} samples of pixel ({}, {})", previous_part + 1, part + 1,
+                                                        previous_begin == GAPS ? "may share" : "share",
+                                                        first.x0 + static_cast<int>(i % first.width), first.y0 + static_cast<int>(i / first.width)));
+            }
+            gaps = gaps || previous_end != begin;
+        }
+    }
+    merged.first_sample = gaps ? GAPS : start.value_or(first.first_sample);
+    for (const Accumulation& part : parts) {
+        merged.passes = std::max(merged.passes, part.passes);
+    }
+    return merged;
+}
+
+bool Accumulation::overlap(const std::span<const PixelStats> pixels, const int first_sample, const std::span<const PixelStats> other_pixels,
+                           const int other_first_sample) {
+    for (std::size_t i = 0; i < pixels.size() && i < other_pixels.size(); i++) {
+        if (pixels[i].samples == 0 || other_pixels[i].samples == 0) {
+            continue;
+        }
+        if (first_sample == GAPS || other_first_sample == GAPS ||
+            (first_sample < other_first_sample + other_pixels[i].samples && other_first_sample < first_sample + pixels[i].samples)) {
+            return true;
+        }
+    }
+    return false;
+}
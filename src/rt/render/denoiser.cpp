@@ -0,0 +1,168 @@
+#include "rt/render/denoiser.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <stdexcept>
+#include "rt/render/thread_pool.hpp"
+
+static constexpr std::array<float, 5> KERNEL{1.f / 16, 1.f / 4, 3.f / 8, 1.f / 4, 1.f / 16};  // B3 spline
+static constexpr float SIGMA_LUMINANCE{4.f};    // Luminance differences tolerated, in standard errors
+static constexpr float SIGMA_NORMAL{128.f};     // Exponent on the cosine between normals
+static constexpr int SPATIAL_VARIANCE_SPP{8};   // Pixels with fewer samples estimate their variance from their neighbours
+static constexpr int SPATIAL_VARIANCE_RADIUS{3};
+
+static float luminance(const Color& color) {
+    return 0.2126f * color.x() + 0.7152f * color.y() + 0.0722f * color.z();
+}
+
+Denoiser::Denoiser(const int width, const int height, const std::span<const PixelStats> pixels) :
+    width_{width},
+    height_{height},
+    guides_{width, height, pixels} {
+    const size_t num_pixels{static_cast<size_t>(width) * height};
+    irradiance_.resize(num_pixels);
+    variance_.resize(num_pixels);
+
+    for (size_t i = 0; i < num_pixels; i++) {
+        const PixelStats& stats{pixels[i]};
+        if (stats.samples == 0) {
+            continue;
+        }
+        const auto n{static_cast<float>(stats.samples)};
+
+        // Demodulate, so the filter only smooths the lighting and the albedo is multiplied back in sharp
+        const Color mean{stats.sum / n};
+        irradiance_[i] = GuideBuffers::demodulate(mean, guides_.albedo[i]);
+
+        // Variance of the mean luminance, scaled like the demodulated colors
+        const float mean_luminance{luminance(mean)};
+        const float albedo_luminance{luminance(GuideBuffers::demodulation(guides_.albedo[i]))};
+        if (stats.samples > 1) {
+            variance_[i] = std::max(0.f, (stats.luminance_sq_sum / n - mean_luminance * mean_luminance) / (n - 1)) / (albedo_luminance * albedo_luminance);
+        }
+    }
+
+    // A few samples that happen to agree (e.g. all in shadow) claim no noise at all and would keep the pixel out of the
+    // filter, so sparse pixels use the spread of the means around them on the same surface where that is larger
+    std::vector<float> spatial_variance(num_pixels);
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            const size_t center{static_cast<size_t>(y) * width + x};
+            if (pixels[center].samples >= SPATIAL_VARIANCE_SPP) {
+                continue;
+            }
+            const bool center_sky{guides_.sky(center)};
+            float count{0};
+            float sum{0};
+            float sum_sq{0};
+            for (int ty = std::max(0, y - SPATIAL_VARIANCE_RADIUS); ty <= std::min(height - 1, y + SPATIAL_VARIANCE_RADIUS); ty++) {
+                for (int tx = std::max(0, x - SPATIAL_VARIANCE_RADIUS); tx <= std::min(width - 1, x + SPATIAL_VARIANCE_RADIUS); tx++) {
+                    const size_t tap{static_cast<size_t>(ty) * width + tx};
+                    if (center_sky != guides_.sky(tap) || (!center_sky && dot(guides_.normal[center], guides_.normal[tap]) < 0.9f)) {
+                        continue;
+                    }
+                    const float tap_luminance{luminance(irradiance_[tap])};
+                    count++;
+                    sum += tap_luminance;
+                    sum_sq += tap_luminance * tap_luminance;
+                }
+            }
+            spatial_variance[center] = count > 1 ? std::max(0.f, (sum_sq - sum * sum / count) / (count - 1)) : 0.f;
+        }
+    }
+    for (size_t i = 0; i < num_pixels; i++) {
+        variance_[i] = std::max(variance_[i], spatial_variance[i]);
+    }
+}
+
+std::vector<Color> Denoiser::denoise() const {
+    std::vector<Color> color{irradiance_};
+    std::vector<float> variance{variance_};
+    std::vector<Color> color_out(color.size());
+    std::vector<float> variance_out(variance.size());
+    for (int pass = 0; pass < PASSES; pass++) {
+        filter(1 << pass, color, variance, color_out, variance_out);
+        std::swap(color, color_out);
+        std::swap(variance, variance_out);
+    }
+
+    // Remodulate
+    for (size_t i = 0; i < color.size(); i++) {
+        color[i] = color[i] * GuideBuffers::demodulation(guides_.albedo[i]);
+    }
+    return color;
+}
+
+void Denoiser::filter(const int step, const std::vector<Color>& color, const std::vector<float>& variance,
+                      std::vector<Color>& color_out, std::vector<float>& variance_out) const {
+    // The luminance stop uses the variance smoothed over 3x3 pixels, a single pixel's estimate is itself noisy
+    const auto blurred_variance = [&](const int x, const int y) {
+        float sum{0};
+        float weight_sum{0};
+        for (int ty = std::max(0, y - 1); ty <= std::min(height_ - 1, y + 1); ty++) {
+            for (int tx = std::max(0, x - 1); tx <= std::min(width_ - 1, x + 1); tx++) {
+                const float weight{(tx == x ? 2.f : 1.f) * (ty == y ? 2.f : 1.f)};
+                sum += weight * variance[static_cast<size_t>(ty) * width_ + tx];
+                weight_sum += weight;
+            }
+        }
+        return sum / weight_sum;
+    };
+
+    const auto filter_row = [&](const int y) {
+        for (int x = 0; x < width_; x++) {
+            const size_t center{static_cast<size_t>(y) * width_ + x};
+            const float center_luminance{luminance(color[center])};
+            const float luminance_tolerance{SIGMA_LUMINANCE * std::sqrt(blurred_variance(x, y)) + 1e-4f};
+            const bool center_sky{guides_.sky(center)};
+
+            Color color_sum{};
+            float variance_sum{0};
+            float weight_sum{0};
+            for (int j = -2; j <= 2; j++) {
+                const int ty{y + j * step};
+                if (ty < 0 || ty >= height_) {
+                    continue;
+                }
+                for (int i = -2; i <= 2; i++) {
+                    const int tx{x + i * step};
+                    if (tx < 0 || tx >= width_) {
+                        continue;
+                    }
+                    const size_t tap{static_cast<size_t>(ty) * width_ + tx};
+
+                    // Sky only mixes with sky, surfaces by the angle between their normals and their depth
+                    float weight{KERNEL[i + 2] * KERNEL[j + 2]};
+                    if (center_sky != guides_.sky(tap)) {
+                        continue;
+                    }
+                    if (!center_sky) {
+                        const float cosine{dot(guides_.normal[center], guides_.normal[tap])};
+                        weight *= std::pow(std::max(0.f, cosine), SIGMA_NORMAL);
+                        const float depth_tolerance{GuideBuffers::SIGMA_DEPTH * guides_.depth_gradient[center] * static_cast<float>((std::abs(i) + std::abs(j)) * step) +
+                                                    1e-3f * guides_.depth[center]};
+                        weight *= std::exp(-std::fabs(guides_.depth[tap] - guides_.depth[center]) / depth_tolerance);
+                    }
+                    weight *= std::exp(-std::fabs(luminance(color[tap]) - center_luminance) / luminance_tolerance);
+
+                    color_sum += weight * color[tap];
+                    variance_sum += weight * weight * variance[tap];
+                    weight_sum += weight;
+                }
+            }
+            // The center tap always has a weight, the sums are never empty
+            color_out[center] = color_sum / weight_sum;
+            variance_out[center] = variance_sum / (weight_sum * weight_sum);
+        }
+    };
+
+    // Rows are handed out one at a time, neighbouring rows cost about the same
+    std::atomic<int> next_row{0};
+    ThreadPool::shared().run([&](unsigned) {
+        for (int y = next_row++; y < height_; y = next_row++) {
+            filter_row(y);
+        }
+    });
+}
@@ -0,0 +1,57 @@
+#include "rt/render/guide_buffers.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+GuideBuffers::GuideBuffers(const int width, const int height, const std::span<const PixelStats> pixels) :
+    width{width},
+    height{height} {
+    const size_t num_pixels{static_cast<size_t>(std::max(width, 0)) * std::max(height, 0)};
+    if (width <= 0 || height <= 0 || pixels.size() != num_pixels) {
+        throw std::invalid_argument("Guide buffers need the sums of every pixel of the image");
+    }
+    albedo.resize(num_pixels);
+    normal.resize(num_pixels);
+    depth.resize(num_pixels);
+    depth_gradient.resize(num_pixels);
+
+    for (size_t i = 0; i < num_pixels; i++) {
+        const PixelStats& stats{pixels[i]};
+        if (stats.samples == 0) {
+            continue;
+        }
+        const auto n{static_cast<float>(stats.samples)};
+        albedo[i] = stats.albedo_sum / n;
+        const vec3 mean_normal{stats.normal_sum / n};
+        if (mean_normal.length_squared() >= SKY_NORMAL_SQ) {
+            normal[i] = mean_normal / mean_normal.length();
+        }
+        depth[i] = stats.depth_sum / n;
+    }
+
+    // Depth change per pixel, towards the closer neighbour on each axis so silhouettes do not count as slopes
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            const size_t i{static_cast<size_t>(y) * width + x};
+            const auto difference = [&](const int nx, const int ny) {
+                return nx < 0 || ny < 0 || nx >= width || ny >= height ? std::numeric_limits<float>::infinity()
+                                                                       : std::fabs(depth[static_cast<size_t>(ny) * width + nx] - depth[i]);
+            };
+            const float horizontal{std::min(difference(x - 1, y), difference(x + 1, y))};
+            const float vertical{std::min(difference(x, y - 1), difference(x, y + 1))};
+            const float gradient{std::max(horizontal, vertical)};
+            depth_gradient[i] = std::isfinite(gradient) ? gradient : 0.f;
+        }
+    }
+}
+
+Color GuideBuffers::demodulation(const Color& albedo) {
+    return {std::max(albedo.x(), MIN_ALBEDO), std::max(albedo.y(), MIN_ALBEDO), std::max(albedo.z(), MIN_ALBEDO)};
+}
+
+Color GuideBuffers::demodulate(const Color& color, const Color& albedo) {
+    const Color factors{demodulation(albedo)};
+    return {color.x() / factors.x(), color.y() / factors.y(), color.z() / factors.z()};
+}
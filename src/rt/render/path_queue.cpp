@@ -0,0 +1,81 @@
+#include "rt/render/path_queue.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+static constexpr int CELL_BITS{9};                               // Origin cell bits per axis in the sort key
+static constexpr int CELL_OFFSET{1 << (CELL_BITS - 1)};          // Cells are centered on the world origin
+
+// Interleaves the low CELL_BITS bits of x, y and z (x in the lowest bit)
+static std::uint32_t morton_code(const std::uint32_t x, const std::uint32_t y, const std::uint32_t z) {
+    const auto spread = [](std::uint32_t v) {
+        v = (v | (v << 16)) & 0x030000FFu;
+        v = (v | (v << 8)) & 0x0300F00Fu;
+        v = (v | (v << 4)) & 0x030C30C3u;
+        v = (v | (v << 2)) & 0x09249249u;
+        return v;
+    };
+    return spread(x) | (spread(y) << 1) | (spread(z) << 2);
+}
+
+void PathQueue::clear() noexcept {
+    for (std::vector<float>* component : {&origin_x_, &origin_y_, &origin_z_, &direction_x_, &direction_y_, &direction_z_,
+                                          &throughput_r_, &throughput_g_, &throughput_b_}) {
+        component->clear();
+    }
+    path_.clear();
+}
+
+void PathQueue::reserve(const std::size_t count) {
+    for (std::vector<float>* component : {&origin_x_, &origin_y_, &origin_z_, &direction_x_, &direction_y_, &direction_z_,
+                                          &throughput_r_, &throughput_g_, &throughput_b_}) {
+        component->reserve(count);
+    }
+    path_.reserve(count);
+}
+
+void PathQueue::push(const Ray& ray, const Color& throughput, const std::uint32_t path) {
+    origin_x_.push_back(ray.origin().x());
+    origin_y_.push_back(ray.origin().y());
+    origin_z_.push_back(ray.origin().z());
+    direction_x_.push_back(ray.direction().x());
+    direction_y_.push_back(ray.direction().y());
+    direction_z_.push_back(ray.direction().z());
+    throughput_r_.push_back(throughput.x());
+    throughput_g_.push_back(throughput.y());
+    throughput_b_.push_back(throughput.z());
+    path_.push_back(path);
+}
+
+Ray PathQueue::ray(const std::size_t i) const noexcept {
+    return {coord3{origin_x_[i], origin_y_[i], origin_z_[i]}, uvec3{direction_x_[i], direction_y_[i], direction_z_[i]}};
+}
+
+void PathQueue::sort_coherent(const float cell_size) {
+    const auto cell = [cell_size](const float coordinate) {
+        const float index{std::floor(coordinate / cell_size) + CELL_OFFSET};
+        return static_cast<std::uint32_t>(std::clamp(index, 0.f, static_cast<float>((1 << CELL_BITS) - 1)));
+    };
+
+    // Key: direction octant above the origin cell's Morton code, queue index in the low 32 bits
+    order_.resize(size());
+    for (std::size_t i = 0; i < size(); i++) {
+        const std::uint32_t octant{static_cast<std::uint32_t>(direction_x_[i] < 0) | static_cast<std::uint32_t>(direction_y_[i] < 0) << 1 |
+                                   static_cast<std::uint32_t>(direction_z_[i] < 0) << 2};
+        const std::uint32_t key{octant << 3 * CELL_BITS | morton_code(cell(origin_x_[i]), cell(origin_y_[i]), cell(origin_z_[i]))};
+        order_[i] = static_cast<std::uint64_t>(key) << 32 | i;
+    }
+    std::ranges::sort(order_);
+
+    for (std::vector<float>* component : {&origin_x_, &origin_y_, &origin_z_, &direction_x_, &direction_y_, &direction_z_,
+                                          &throughput_r_, &throughput_g_, &throughput_b_}) {
+        permute(*component, scratch_);
+    }
+    permute(path_, path_scratch_);
+}
+
+template<class T> void PathQueue::permute(std::vector<T>& values, std::vector<T>& scratch) const {
+    scratch.resize(values.size());
+    std::ranges::transform(order_, scratch.begin(), [&values](const std::uint64_t entry) { return values[static_cast<std::uint32_t>(entry)]; });
+    values.swap(scratch);
+}
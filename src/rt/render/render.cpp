@@ -1,184 +1,1091 @@
+#include <algorithm>
+#include <atomic>
+#include <array>
+#include <bit>
 #include <thread>
+#include <chrono>
+#include <condition_variable>
+#include <csignal>
+#include <filesystem>
 #include <format>
 #include <fstream>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <ranges>
 #include "rt/render/render.hpp"
+#include "rt/render/denoiser.hpp"
+#include "rt/render/path_queue.hpp"
+#include "rt/render/thread_pool.hpp"
+#include "rt/render/upsampler.hpp"
 #include "rt/utilities.hpp"
 #include "rt/math/ray.hpp"
+#include "rt/math/ray_packet.hpp"
 #include "rt/geom/hittable_list.hpp"
+#include "rt/geom/sphere.hpp"
 #include "rt/math/vec3.hpp"
-#include "terrain/noise/opensimplex2s.hpp"
+#include "terrain/noise/fractal_noise.hpp"
 
-static constexpr int ASSIGN_PIXELS{32};                                 // Work (number of pixels) to assign at a time to a ray/worker thread
 static constexpr int RAY_DEPTH{16};                                      // Max number of ray bounces per ray
+static constexpr int ROULETTE_MIN_BOUNCES{3};                            // Bounces before Russian roulette may end a path
+static constexpr float ROULETTE_MAX_SURVIVAL{0.95f};                     // Even bright paths end at random eventually
 static constexpr Color BLUE_BACKGROUND_COLOR{0.6, 0.6, 1.0};      // Sky color
 static constexpr Color ORANGE_BACKGROUND_COLOR{1.0, 0.4, 0.0};    // Sky color near horizon
 static constexpr Color AMBIENT_LIGHT{0.01, 0.01, 0.01};              // Effective ambient color
 
-// Draw pixels into a .ppm image file (multithreaded pixel handling with a sort of work queue)
-void Renderer::render(const HittableList& world) const {
-    const unsigned ray_threads{std::max(1u, std::thread::hardware_concurrency() - 1)};  // Reserve 1 thread for logging
-    #ifndef NDEBUG
-    std::cout << "This system can support " << ray_threads + 1 << " threads" << std::endl;
-    #endif
+static thread_local size_t rays_traced{0};                              // Rays cast by this thread, for tile costs
 
-    std::atomic<size_t> next{};     // Batched pixels needing work
-    std::atomic<size_t> done{};     // Completed pixels
+static constexpr float ADAPTIVE_LUMINANCE_FLOOR{0.02f};                // Adaptive error is relative to at least this luminance
+
+static constexpr std::size_t WAVEFRONT_MAX_PATHS{1 << 16};             // Most paths of a wavefront batch, which never spans tiles
+static constexpr float WAVEFRONT_CELL_SIZE{1.f};                        // Origin grid cell size for ray sorting, world units
+
+static constexpr int MAX_GUIDE_SAMPLES{4};                              // Camera rays per pixel of the full-resolution pass of a downscaled render
+
+static constexpr const char* CHECKPOINT_FILE{"image.checkpoint"};
+static constexpr double CHECKPOINT_INTERVAL_PER_WRITE{100};              // Checkpoints wait at least this many times their last write, for under 1% overhead
+
+static std::atomic<bool> interrupted{false};                            // Set by SIGINT/SIGTERM during a render
+static_assert(std::atomic<bool>::is_always_lock_free, "Needed to set it from a signal handler");
+
+static void on_interrupt(int) {
+    interrupted = true;
+}
 
+// Routes SIGINT/SIGTERM to on_interrupt while it lives, and puts the previous handlers back however the render ends
+struct InterruptHandlers {
+    using handler = void (*)(int);
+
+    InterruptHandlers() : previous_sigint{std::signal(SIGINT, on_interrupt)}, previous_sigterm{std::signal(SIGTERM, on_interrupt)} {}
+    ~InterruptHandlers() {
+        std::signal(SIGINT, previous_sigint);
+        std::signal(SIGTERM, previous_sigterm);
+    }
+    InterruptHandlers(const InterruptHandlers&) = delete;
+    InterruptHandlers& operator=(const InterruptHandlers&) = delete;
+
+    handler previous_sigint;
+    handler previous_sigterm;
+};
+
+// Multiple importance sampling weight of a sample from the strategy with density pdf against one other strategy
+static float power_heuristic(const float pdf, const float other_pdf) {
+    return pdf * pdf / (pdf * pdf + other_pdf * other_pdf);
+}
+
+// Rec. 709 luminance of a linear color
+static float luminance(const Color& color) {
+    return 0.2126f * color.x() + 0.7152f * color.y() + 0.0722f * color.z();
+}
+
+// Sample sums of every pixel of a render, allocated without being written so the render's workers do the first
+// writes (see render())
+struct Film {
+    explicit Film(const size_t size) : pixels{std::allocator<PixelStats>{}.allocate(size), size} {}
+    ~Film() { std::allocator<PixelStats>{}.deallocate(pixels.data(), pixels.size()); }
+    Film(const Film&) = delete;
+    Film& operator=(const Film&) = delete;
+
+    std::span<PixelStats> pixels;
+};
+static_assert(std::is_trivially_destructible_v<PixelStats>, "Film never destroys its pixels");
+
+// Quantizes a 0 to 1 color channel to one byte
+static uint8_t to_byte(const float channel) {
+    constexpr Interval color_intensity{0.f, 0.999f};
+    return static_cast<uint8_t>(256 * color_intensity.clamp(channel));
+}
+
+// Draw pixels into a .ppm image file (multithreaded tile handling with work stealing, in one or more passes)
+void Renderer::render(const HittableList& world) const {
+    using clock = std::chrono::steady_clock;
     const size_t num_pixels = image_width_ * image_height_;
-    std::vector<Color> pixel_colors(num_pixels);
+    const size_t num_tiles{TileScheduler::count_tiles(image_width_, image_height_, settings_.tile_size)};
+    const bool progressive{settings_.time_budget > 0 || settings_.write_interval > 0};
+    const bool adaptive{settings_.adaptive_threshold > 0};
+    const bool checkpoints{settings_.checkpoint_interval > 0};
+    const auto start{clock::now()};
+    const auto deadline{start + std::chrono::duration_cast<clock::duration>(std::chrono::duration<double>(settings_.time_budget))};
+    const auto past_deadline = [&] { return settings_.time_budget > 0 && clock::now() >= deadline; };
+    Utilities::set_sampler(settings_.sampler);
+
+    // Accumulation buffer, continued from the checkpoint when resuming. Random streams are keyed by the sample
+    // index, so a resumed render continues after the samples already accumulated instead of repeating them
+    const bool distributed{settings_.num_workers > 1};
+    const std::string checkpoint_file{distributed ? std::format("image.worker{}.checkpoint", settings_.worker) : CHECKPOINT_FILE};
+    const std::vector<int> targets{sample_targets()};
+    const int sample_offset{first_sample()};
+    std::mutex accumulation_mutex;      // Tiles are committed while the intermediate writer may be reading
+    int first_pass{0};
+    std::optional<Accumulation> resumed;
+    if (settings_.resume && std::filesystem::exists(checkpoint_file)) {
+        resumed = Accumulation::read(checkpoint_file);
+        if (resumed->width != image_width_ || resumed->height != image_height_ || resumed->x0 != image_x0_ || resumed->y0 != image_y0_ ||
+            resumed->seed != settings_.seed) {
+            throw std::runtime_error(std::format("Checkpoint {} is of a {}x{}+{}+{} render with seed {}, not {}x{}+{}+{} with seed {}", checkpoint_file,
+                                                 resumed->width, resumed->height, resumed->x0, resumed->y0, resumed->seed,
+                                                 image_width_, image_height_, image_x0_, image_y0_, settings_.seed));
+        }
+        // Samples continue after the ones a pixel has, which are only the file's if it holds this process's range
+        if (resumed->first_sample != sample_offset) {
+            throw std::runtime_error(resumed->first_sample == Accumulation::GAPS ?
+                std::format("Checkpoint {} is a merge with gaps between its samples and cannot be resumed, merge all workers first", checkpoint_file) :
+                std::format("Checkpoint {} holds samples from index {} on, this process renders them from {} on", checkpoint_file,
+                            resumed->first_sample, sample_offset));
+        }
+        first_pass = resumed->passes;
+    } else if (settings_.resume) {
+        std::cout << "No checkpoint " << checkpoint_file << " to resume from, starting a new render" << std::endl;
+    }
 
-    // Thread generation scope
+    // Every worker first writes exactly its own Morton run of tiles, without stealing, which is where it starts every
+    // pass scheduled without tile costs. Passes dealt by cost (after a pilot, progressive or adaptive pass) and
+    // stolen tiles do not keep to these runs
+    const Film film{num_pixels};
+    const std::span<PixelStats> pixels{film.pixels};
     {
-        std::vector<std::jthread> threads;
-        threads.reserve(ray_threads);
+        ThreadPool& pool{ThreadPool::shared()};
+        TileScheduler owners{image_width_, image_height_, settings_.tile_size, pool.size()};
+        pool.run([&](const unsigned worker) {
+            while (const std::optional<ImageTile> tile{owners.next(worker, false)}) {
+                for (int y = 0; y < tile->height; y++) {
+                    const size_t row{static_cast<size_t>(tile->y0 + y) * image_width_ + tile->x0};
+                    if (resumed) {
+                        std::uninitialized_copy_n(resumed->pixels.begin() + static_cast<std::ptrdiff_t>(row), tile->width, pixels.begin() + static_cast<std::ptrdiff_t>(row));
+                    } else {
+                        std::uninitialized_value_construct_n(pixels.begin() + static_cast<std::ptrdiff_t>(row), tile->width);
+                    }
+                }
+            }
+        });
+    }
+    if (resumed) {
+        resumed.reset();
+        const auto [fewest, most]{std::ranges::minmax(pixels | std::views::transform(&PixelStats::samples))};
+        std::cout << std::format("Resuming from {}: {}-{} spp after {} pass(es)", checkpoint_file, fewest, most, first_pass) << std::endl;
+    }
 
-        // Separate thread for logging progress
-        std::jthread log_progress([&]() {
-            using namespace std::chrono_literals;
+    // SIGINT/SIGTERM stop the render at the next tile and flush a checkpoint
+    interrupted = false;
+    std::optional<InterruptHandlers> interrupt_handlers;
+    if (checkpoints) {
+        interrupt_handlers.emplace();
+    }
 
-            constexpr int bar_width = 80;
+    // Runs action on a background thread every interval() seconds, asked again before every wait, until stopped
+    const auto every = [](const function<double()>& interval, const function<void()>& action) {
+        return std::jthread([interval, action](const std::stop_token& stop) {
+            std::mutex wait_mutex;
+            std::condition_variable_any wake;
             while (true) {
-                const size_t completed = done.load(std::memory_order_relaxed);
-                const double progress = (num_pixels == 0) ? 1.0 : std::min(static_cast<double>(completed) / static_cast<double>(num_pixels), 1.0);
-
-                if (progress >= 1.0) {
+                std::unique_lock wait_lock{wait_mutex};
+                wake.wait_for(wait_lock, stop, std::chrono::duration<double>(interval()), [] { return false; });   // Only wakes early to stop
+                if (stop.stop_requested()) {
                     break;
                 }
-                const int filled_bar = static_cast<int>(std::clamp(progress, 0.0, 0.999) * (bar_width + 1));
+                action();
+            }
+        });
+    };
 
-                std::string bar(bar_width, '.');
-                std::fill_n(bar.begin(), std::min<std::size_t>(filled_bar, bar.size()), '#');
-                const std::string line = std::format("[{}] {:6.2f}%", bar, progress * 100.0);
-                std::cout << "\x1b[2K\r" << line << std::flush;
+    // Intermediate images, published with a rename so readers never see a partial file. A failed write (e.g. a full
+    // disk) only skips that image, the render goes on and the next interval tries again
+    std::jthread writer;
+    if (settings_.write_interval > 0 && !distributed) {
+        writer = every([&] { return settings_.write_interval; }, [&] {
+            std::vector<Color> snapshot;
+            {
+                std::scoped_lock lock{accumulation_mutex};
+                snapshot = resolve(pixels);
+            }
+            try {
+                write_to_file("image.ppm.part", snapshot, true);
+                std::filesystem::rename("image.ppm.part", "image.ppm");
+            } catch (const std::exception& error) {
+                std::cerr << "\nCould not write the intermediate image.ppm: " << error.what() << std::endl;
+            }
+        });
+    }
+
+    // Checkpoints, copied under the lock and written outside of it. A failed periodic checkpoint (e.g. a full disk or a
+    // lost write permission) is reported and the render goes on, the next interval tries again
+    int passes_started{0};
+    int checkpoints_written{0};
+    double checkpoint_seconds{0};       // Time spent writing checkpoints, only touched by one thread at a time
+    double last_checkpoint_seconds{0};  // Time the last checkpoint took, copy under the lock included
+    const auto checkpoint = [&] {
+        const auto checkpoint_start{clock::now()};
+        Accumulation snapshot{image_width_, image_height_, settings_.seed, 0, {}, image_x0_, image_y0_, sample_offset};
+        {
+            std::scoped_lock lock{accumulation_mutex};
+            snapshot.pixels.assign(pixels.begin(), pixels.end());
+            snapshot.passes = first_pass + passes_started;
+        }
+        snapshot.write(checkpoint_file);
+        checkpoints_written++;
+        last_checkpoint_seconds = std::chrono::duration<double>(clock::now() - checkpoint_start).count();
+        checkpoint_seconds += last_checkpoint_seconds;
+    };
 
-                std::this_thread::sleep_for(100ms);
+    // Checkpoints too slow for the interval asked for (a large frame on a slow disk) are spaced out so they stay
+    // under 1% of the render time. Only called by the checkpointer
+    double announced_interval{settings_.checkpoint_interval};
+    const auto checkpoint_interval = [&] {
+        const double interval{std::max(settings_.checkpoint_interval, CHECKPOINT_INTERVAL_PER_WRITE * last_checkpoint_seconds)};
+        if (interval > announced_interval * 1.1) {
+            std::cout << std::format("\nCheckpoints take {:.3f} s, writing them every {:.1f} s instead of every {:g} s", last_checkpoint_seconds,
+                                     interval, settings_.checkpoint_interval) << std::endl;
+            announced_interval = interval;
+        }
+        return interval;
+    };
+    std::jthread checkpointer;
+    if (checkpoints) {
+        checkpointer = every(checkpoint_interval, [&] {
+            try {
+                checkpoint();
+            } catch (const std::exception& error) {
+                std::cerr << "\nCould not write checkpoint " << checkpoint_file << ": " << error.what() << std::endl;
             }
-            // Progress completed
-            std::cout << "\x1b[2K\r" << std::format("[{}] {:6.2f}%", std::string(bar_width, '#'), 100.0) << std::endl;
         });
+    }
 
-        // Assign all available threads pixels to color
-        for (unsigned thread = 0; thread < ray_threads; thread++) {
-            threads.emplace_back([&] {
-                while (true) {
-                    // Each thread should be assigned 32 pixels at a time
-                    const size_t start{next.fetch_add(ASSIGN_PIXELS, std::memory_order_relaxed)};
-                    if (start >= num_pixels) {
-                        break;
-                    }
-                    const size_t end{std::min(start + ASSIGN_PIXELS, num_pixels)};
+    // The first pass always completes (unless interrupted) so that every pixel has a sample. Passes after it are
+    // scheduled by the tile times of the pass before when the costs are wanted (pilot, progressive or adaptive)
+    std::vector<double> tile_costs;
+    std::vector<double> pass_seconds(num_tiles);
+    std::vector<size_t> pass_rays(num_tiles);
+    for (int pass = 0; !interrupted && !(pass > 0 && past_deadline()); pass++) {
+        bool pass_needed{false};
+        for (size_t pixel = 0; pixel < num_pixels && !pass_needed; pixel++) {
+            pass_needed = pass_samples(pixels[pixel], targets[pixel], pass) > 0;
+        }
+        if (!pass_needed) {
+            break;
+        }
+        {
+            std::scoped_lock lock{accumulation_mutex};
+            passes_started++;
+        }
 
-                    // Pixels are written from left to right, one row at a time
-                    for (size_t i = start; i < end; i++) {
-                        const int x{static_cast<int>(i) % image_width_};
-                        const int y{static_cast<int>(i) / image_width_};
-                        pixel_colors[i] = pixel_color(x, y, world);
-                    }
+        std::ranges::fill(pass_seconds, 0.0);
+        for_each_tile(image_width_, image_height_, settings_.tile_size, [&](const ImageTile& tile) {
+            if (interrupted || (pass > 0 && past_deadline())) {
+                return;
+            }
+            const size_t rays_before{rays_traced};
+            const auto tile_start{clock::now()};
+
+            // Shade the tile into a private buffer, then commit it row by row (only this tile's thread writes its pixels).
+            // Each pixel continues at the sample index after the ones it already has, which keys its random streams
+            thread_local std::vector<PixelStats> tile_stats;
+            thread_local std::vector<SampleRange> tile_samples;
+            tile_stats.resize(static_cast<size_t>(tile.width) * tile.height);
+            tile_samples.resize(tile_stats.size());
+            for (int y = 0; y < tile.height; y++) {
+                for (int x = 0; x < tile.width; x++) {
+                    const size_t pixel{static_cast<size_t>(tile.y0 + y) * image_width_ + tile.x0 + x};
+                    tile_samples[static_cast<size_t>(y) * tile.width + x] = {sample_offset + pixels[pixel].samples,
+                                                                             pass_samples(pixels[pixel], targets[pixel], pass)};
+                }
+            }
+            sample_tile(tile, world, tile_samples, tile_stats);
+            pass_seconds[tile.index] = std::chrono::duration<double>(clock::now() - tile_start).count();
+            pass_rays[tile.index] = rays_traced - rays_before;
+
+            std::scoped_lock lock{accumulation_mutex};
+            for (int y = 0; y < tile.height; y++) {
+                for (int x = 0; x < tile.width; x++) {
+                    pixels[static_cast<size_t>(tile.y0 + y) * image_width_ + tile.x0 + x].add(tile_stats[static_cast<size_t>(y) * tile.width + x]);
+                }
+            }
+        }, tile_costs);
+
+        if (settings_.pilot_pass || progressive || adaptive) {
+            tile_costs = pass_seconds;
+        }
+        if (progressive || adaptive) {
+            // Pixels skipped at the deadline or converged keep their previous sample count
+            const auto [fewest, most]{std::ranges::minmax(pixels | std::views::transform(&PixelStats::samples))};
+            const double total{std::accumulate(pixels.begin(), pixels.end(), 0.0, [](const double sum, const PixelStats& stats) { return sum + stats.samples; })};
+            std::cout << std::format("Pass {}: {} spp (mean {:.1f}) after {:.1f} s", pass + 1,
+                                     fewest == most ? std::to_string(most) : std::format("{}-{}", fewest, most),
+                                     total / static_cast<double>(num_pixels),
+                                     std::chrono::duration<double>(clock::now() - start).count()) << std::endl;
+        }
+        #ifndef NDEBUG
+        std::vector<double> sorted{pass_seconds};
+        std::sort(sorted.begin(), sorted.end());
+        if (!sorted.empty() && sorted[sorted.size() / 2] > 0) {
+            std::cout << std::format("Pass {}: {} rays in {} tiles, costliest tile {:.1f}x the median", pass + 1,
+                                     std::accumulate(pass_rays.begin(), pass_rays.end(), size_t{0}), num_tiles,
+                                     sorted.back() / sorted[sorted.size() / 2]) << std::endl;
+        }
+        #endif
+    }
+    for (std::jthread* thread : {&writer, &checkpointer}) {
+        if (thread->joinable()) {
+            thread->request_stop();
+            thread->join();
+        }
+    }
 
-                    // Keep track of the pixels finished
-                    done.fetch_add(end - start, std::memory_order_relaxed);
+    // Done generating rays, write pixel colors to file (and a final checkpoint to continue from with a higher -n). Workers
+    // only write their sums, the image comes from merging them
+    if (!distributed) {
+        if (settings_.downscale > 1) {
+            write_image(image_width_, image_height_, pixels, sample_offset, settings_, camera_.image_width(), camera_.image_height(),
+                        [&](std::vector<std::vector<Color>>& images) { return upsample(world, pixels, images); });
+        } else {
+            write_image(image_width_, image_height_, pixels, sample_offset, settings_, camera_.image_width(), camera_.image_height());
+        }
+    }
+    if (checkpoints || distributed) {
+        checkpoint();
+        const double render_seconds{std::chrono::duration<double>(clock::now() - start).count()};
+        std::cout << std::format("{}Wrote {} checkpoint(s) to {} in {:.2f} s ({:.2f}% of render time)",
+                                 interrupted ? "Interrupted. " : "", checkpoints_written, checkpoint_file,
+                                 checkpoint_seconds, 100 * checkpoint_seconds / render_seconds) << std::endl;
+    }
+}
+
+void Renderer::merge(const std::vector<std::string>& filenames, const RenderSettings& settings) {
+    std::vector<Accumulation> parts;
+    for (const std::string& filename : filenames) {
+        parts.push_back(Accumulation::read(filename));
+    }
+    const Accumulation merged{Accumulation::merge(parts)};
+    parts.clear();
+
+    const auto [fewest, most]{std::ranges::minmax(merged.pixels | std::views::transform(&PixelStats::samples))};
+    std::cout << std::format("Merged {} file(s): {}x{}, {} spp{}", filenames.size(), merged.width, merged.height,
+                             fewest == most ? std::to_string(most) : std::format("{}-{}", fewest, most),
+                             merged.first_sample == Accumulation::GAPS ? " (with gaps between samples, cannot be resumed)" : "") << std::endl;
+    RenderSettings output{settings};
+    output.seed = merged.seed;
+    write_image(merged.width, merged.height, merged.pixels, merged.first_sample, output, merged.width, merged.height);
+    merged.write(CHECKPOINT_FILE);
+    std::cout << "Wrote to " << CHECKPOINT_FILE << std::endl;
+}
+
+void Renderer::write_image(const int width, const int height, const std::span<const PixelStats> pixels, const int first_sample, const RenderSettings& settings,
+                           const int frame_width, const int frame_height, const function<Accumulation(std::vector<std::vector<Color>>&)>& upsample) {
+    // The noisy image, then the denoised one if asked for
+    std::vector<std::vector<Color>> images{resolve(pixels)};
+    if (settings.denoise) {
+        const auto start{std::chrono::steady_clock::now()};
+        images.push_back(Denoiser{width, height, pixels}.denoise());
+        std::cout << std::format("\rDenoised in {:.2f} s", std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count()) << std::endl;
+    }
+    int image_width{width};
+    int image_height{height};
+    Accumulation upsampled{};
+    if (upsample) {
+        const auto start{std::chrono::steady_clock::now()};
+        upsampled = upsample(images);
+        image_width = upsampled.width;
+        image_height = upsampled.height;
+        std::cout << std::format("\rUpsampled {}x{} to {}x{} in {:.2f} s", width, height, image_width, image_height,
+                                 std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count()) << std::endl;
+    }
+
+    // A crop is written on its own, or into a black image of the whole frame
+    const bool padded{settings.pad_crop && (image_width != frame_width || image_height != frame_height)};
+    const auto write = [&](const std::string& filename, const std::vector<Color>& colors, const bool gamma) {
+        if (!padded) {
+            write_to_file(filename, image_width, image_height, colors, gamma);
+            return;
+        }
+        std::vector<Color> frame(static_cast<size_t>(frame_width) * frame_height);
+        for (int y = 0; y < image_height; y++) {
+            std::copy_n(colors.begin() + static_cast<std::ptrdiff_t>(y) * image_width, image_width,
+                        frame.begin() + static_cast<std::ptrdiff_t>(settings.crop_y + y) * frame_width + settings.crop_x);
+        }
+        write_to_file(filename, frame_width, frame_height, frame, gamma);
+    };
+    if (settings.write_aovs) {
+        const auto [albedos, normals, depths]{aov_images(upsample ? std::span<const PixelStats>{upsampled.pixels} : pixels)};
+        write("albedo.ppm", albedos, true);
+        write("normal.ppm", normals, false);
+        write("depth.ppm", depths, false);
+        std::cout << "\rWrote to albedo.ppm, normal.ppm and depth.ppm" << std::endl;
+    }
+    write("image.ppm", images.back(), true);
+    std::cout << std::format("\rWrote to image.ppm ({}x{}{})", image_width, image_height,
+                             image_width != frame_width || image_height != frame_height ?
+                             std::format("+{}+{} of {}x{}{}", settings.crop_x, settings.crop_y, frame_width, frame_height, padded ? ", padded" : "") : "")
+              << std::endl;
+
+    if (!settings.reference.empty()) {
+        const Accumulation reference{Accumulation::read(settings.reference)};
+        const bool whole_frame{reference.width == frame_width && reference.height == frame_height};
+        if (!whole_frame && (reference.width != image_width || reference.height != image_height)) {
+            throw std::invalid_argument(std::format("Reference {} is {}x{}, not {}x{} or {}x{}", settings.reference, reference.width, reference.height,
+                                                    image_width, image_height, frame_width, frame_height));
+        }
+        if (reference.seed != settings.seed) {
+            throw std::invalid_argument(std::format("Reference {} is of seed {}, not {}", settings.reference, reference.seed, settings.seed));
+        }
+
+        // Pixels of the reference in the window of the image, all of them unless it is a crop of a whole-frame reference
+        std::vector<PixelStats> window(static_cast<size_t>(image_width) * image_height);
+        const int x0{whole_frame ? settings.crop_x : 0};
+        const int y0{whole_frame ? settings.crop_y : 0};
+        for (int y = 0; y < image_height; y++) {
+            std::copy_n(reference.pixels.begin() + static_cast<std::ptrdiff_t>(y0 + y) * reference.width + x0, image_width,
+                        window.begin() + static_cast<std::ptrdiff_t>(y) * image_width);
+        }
+        // Random streams are keyed by seed, pixel and sample index, so samples the reference shares with the image are
+        // the same paths. An upsampled image was traced at other pixels, whose streams the reference does not share
+        if (!upsample && Accumulation::overlap(pixels, first_sample, window, reference.first_sample)) {
+            std::cerr << std::format("Not reporting the RMSE: reference {} holds samples of this image, which bias it low. Render the "
+                                     "reference from other sample indices, e.g. with -n 2N --worker 1/2 for up to N spp here",
+                                     settings.reference) << std::endl;
+            return;
+        }
+        const std::vector<Color> expected{resolve(window)};
+
+        // Error of what is displayed: gamma-corrected colors, clamped to the displayable range
+        const auto rmse = [&expected](const std::vector<Color>& colors) {
+            double squared_error{0};
+            for (size_t i = 0; i < colors.size(); i++) {
+                for (int channel = 0; channel < 3; channel++) {
+                    const auto display = [channel](const Color& color) { return std::clamp(std::pow(std::fabs(color[channel]), 1 / 2.2f), 0.f, 1.f); };
+                    const double difference{display(colors[i]) - display(expected[i])};
+                    squared_error += difference * difference;
                 }
-            });
+            }
+            return std::sqrt(squared_error / (3.0 * static_cast<double>(colors.size())));
+        };
+        const auto [fewest, most]{std::ranges::minmax(window | std::views::transform(&PixelStats::samples))};
+        std::cout << std::format("RMSE against {} ({} spp): {:.5f}", settings.reference, fewest == most ? std::to_string(most) : std::format("{}-{}", fewest, most), rmse(images.front()));
+        if (settings.denoise) {
+            std::cout << std::format(", denoised {:.5f}", rmse(images.back()));
         }
-    }   // Auto-join threads, start coloring
-    // Done generating rays, write pixel colors to file
-    write_to_file("image.ppm", pixel_colors, true);
-    std::cout << "\rWrote to image.ppm" << std::endl;
+        std::cout << std::endl;
+    }
 }
 
-// Get noise values and draw results into a .ppm image file
-void Renderer::render(const OpenSimplex2S& simplex, const int freq) const {
-    const size_t num_pixels = image_width_ * image_height_;
-    std::vector<Color> pixel_colors;
-    pixel_colors.reserve(num_pixels);
+std::array<std::vector<Color>, 3> Renderer::aov_images(const std::span<const PixelStats> pixels) {
+    std::array<std::vector<Color>, 3> aovs;
+    auto& [albedos, normals, depths]{aovs};
+    albedos.resize(pixels.size());
+    normals.resize(pixels.size());
+    depths.resize(pixels.size());
+    float far{std::numeric_limits<float>::min()};
+    for (const PixelStats& stats : pixels) {
+        far = std::max(far, stats.depth_sum / static_cast<float>(std::max(stats.samples, 1)));
+    }
+    for (size_t i = 0; i < pixels.size(); i++) {
+        const float n{static_cast<float>(std::max(pixels[i].samples, 1))};
+        albedos[i] = pixels[i].albedo_sum / n;
+        normals[i] = 0.5f * (pixels[i].normal_sum / n + vec3{1, 1, 1});
+        depths[i] = Color{1, 1, 1} * (pixels[i].depth_sum / n / far);
+    }
+    return aovs;
+}
+
+std::vector<int> Renderer::sample_targets() const {
+    const int num_samples{camera_.num_samples()};
+    if (!settings_.split_tiles) {
+        // Sample ranges: every worker takes an equal share of each pixel's samples
+        const int share{num_samples / settings_.num_workers + (settings_.worker < num_samples % settings_.num_workers ? 1 : 0)};
+        return std::vector<int>(static_cast<size_t>(image_width_) * image_height_, share);
+    }
 
-    for (int i = 0; i < image_height_; i++) {
-        for (int j = 0; j < image_width_; j++) {
-            const double x(static_cast<double>(j) / image_width_ * freq);
-            const double y(static_cast<double>(i) / image_height_ * freq);
-            const double output{(simplex.noise2(x, y) + 1.f) / 2};
-            const float grayscale{static_cast<float>(output)};
-            pixel_colors.emplace_back(grayscale , grayscale, grayscale);
+    // Tile sets: every worker takes all samples of every num_workers-th tile (row-major tile index)
+    const int tile_size{settings_.tile_size};
+    const int tiles_x{(image_width_ + tile_size - 1) / tile_size};
+    std::vector<int> targets(static_cast<size_t>(image_width_) * image_height_);
+    for (int y = 0; y < image_height_; y++) {
+        for (int x = 0; x < image_width_; x++) {
+            const int tile{y / tile_size * tiles_x + x / tile_size};
+            targets[static_cast<size_t>(y) * image_width_ + x] = tile % settings_.num_workers == settings_.worker ? num_samples : 0;
+        }
+    }
+    return targets;
+}
+
+int Renderer::first_sample() const {
+    if (settings_.split_tiles) {
+        return 0;
+    }
+    // Same shares as sample_targets(), the workers before this one take the lower indices
+    const int num_samples{camera_.num_samples()};
+    return settings_.worker * (num_samples / settings_.num_workers) + std::min(settings_.worker, num_samples % settings_.num_workers);
+}
+
+int Renderer::pass_samples(const PixelStats& stats, const int target, const int pass) const {
+    const int remaining{target - stats.samples};
+    if (remaining <= 0) {
+        return 0;
+    }
+    if (pass == 0 && settings_.pilot_pass) {
+        return 1;
+    }
+    if (settings_.adaptive_threshold > 0) {
+        if (stats.samples < settings_.min_samples) {
+            return std::min(settings_.min_samples - stats.samples, remaining);
+        }
+        if (relative_error(stats) <= settings_.adaptive_threshold) {
+            return 0;
         }
+        return std::min(stats.samples, remaining);      // Doubles the pixel's samples
+    }
+    if (settings_.time_budget > 0 || settings_.write_interval > 0) {
+        return std::min(std::max(stats.samples, 1), remaining);
+    }
+    return remaining;
+}
+
+void Renderer::add_sample(PixelStats& stats, const Color& color) {
+    const float color_luminance{luminance(color)};
+    stats.sum += color;
+    stats.luminance_sq_sum += color_luminance * color_luminance;
+    stats.samples++;
+}
+
+void Renderer::add_guides(PixelStats& stats, const Ray& camera_ray, const HitRecord* camera_hit) {
+    if (camera_hit == nullptr) {
+        stats.albedo_sum += sky_color(camera_ray);
+        return;
+    }
+    stats.albedo_sum += camera_hit->material().albedo();
+    stats.normal_sum += camera_hit->front_face() ? camera_hit->normal() : -camera_hit->normal();
+    stats.depth_sum += camera_hit->t();
+}
+
+float Renderer::relative_error(const PixelStats& stats) {
+    if (stats.samples < 2) {
+        return std::numeric_limits<float>::infinity();
+    }
+    const auto n{static_cast<float>(stats.samples)};
+    const float mean{luminance(stats.sum) / n};
+    const float variance{std::max(0.f, (stats.luminance_sq_sum / n - mean * mean) * n / (n - 1))};
+    // Standard error of the mean, relative to its luminance (floored, dark pixels would never converge otherwise)
+    return std::sqrt(variance / n) / std::max(mean, ADAPTIVE_LUMINANCE_FLOOR);
+}
+
+std::vector<Color> Renderer::resolve(const std::span<const PixelStats> pixels) {
+    std::vector<Color> pixel_colors(pixels.size());
+    std::ranges::transform(pixels, pixel_colors.begin(), [](const PixelStats& stats) {
+        return stats.samples > 0 ? stats.sum / static_cast<float>(stats.samples) : Color{0, 0, 0};
+    });
+    return pixel_colors;
+}
+
+// Get noise values and draw results into a .ppm image file (same tile scheduling as above)
+void Renderer::render(const FractalNoise& noise, const int width, const int height, const float freq) const {
+    if (width <= 0 || height <= 0) {
+        throw std::invalid_argument(std::format("Invalid noise map size {}x{}", width, height));
     }
+    const float spacing{freq / static_cast<float>(width)};      // Square pixels, freq noise units across the width
+    std::vector<uint8_t> bytes(static_cast<size_t>(width) * height * 3);
 
-    write_to_file("noise.ppm", pixel_colors, false);
+    const auto start{std::chrono::steady_clock::now()};
+    for_each_tile(width, height, NoiseTileCache::TILE_SIZE, [&](const ImageTile& tile) {
+        thread_local std::vector<float> samples;
+        samples.resize(static_cast<size_t>(tile.width) * tile.height);
+        noise.fill(tile.x0, tile.y0, tile.width, tile.height, spacing, samples);
+
+        // Grayscale straight into the image rows covered by this tile
+        for (int y = 0; y < tile.height; y++) {
+            uint8_t* row{bytes.data() + (static_cast<size_t>(tile.y0 + y) * width + tile.x0) * 3};
+            for (int x = 0; x < tile.width; x++) {
+                const uint8_t gray{to_byte((samples[static_cast<size_t>(y) * tile.width + x] + 1.f) / 2)};
+                std::fill_n(row + 3 * x, 3, gray);
+            }
+        }
+    });
+    const std::chrono::duration<double> elapsed{std::chrono::steady_clock::now() - start};
+    std::cout << std::format("Noise preview {}x{}: {:.1f} Mpoints/s", width, height,
+                             static_cast<double>(width) * height / elapsed.count() / 1e6) << std::endl;
+
+    write_to_file("noise.ppm", width, height, bytes);
     std::cout << "Wrote to noise.ppm" << std::endl;
 }
 
-Color Renderer::pixel_color(const int x, const int y, const HittableList& world) const {
-    Color pixel_color{0, 0, 0};
-    for (int sample = 0; sample < camera_.num_samples(); sample++) {
-        Ray ray{generate_ray(x, y)};
-        pixel_color += ray_color(ray, RAY_DEPTH, world);
+void Renderer::for_each_tile(const int width, const int height, const int tile_size, const function<void(const ImageTile&)>& work,
+                             const std::vector<double>& tile_costs, const bool show_progress) {
+    ThreadPool& pool{ThreadPool::shared()};
+    TileScheduler scheduler{width, height, tile_size, pool.size(), tile_costs};
+    const size_t num_pixels{static_cast<size_t>(width) * height};
+    std::atomic<size_t> done{};     // Completed pixels
+
+    // Each worker works through its own tiles, then steals what is left
+    pool.start([&](const unsigned worker) {
+        while (const std::optional<ImageTile> tile{scheduler.next(worker)}) {
+            work(*tile);
+
+            // Keep track of the pixels finished
+            done.fetch_add(static_cast<size_t>(tile->width) * tile->height, std::memory_order_relaxed);
+        }
+    });
+    if (!show_progress) {
+        pool.wait();
+        return;
     }
-    pixel_color /= static_cast<float>(camera_.num_samples());
-    return pixel_color;
+
+    // The calling thread logs progress until the workers are done
+    using namespace std::chrono_literals;
+    constexpr int bar_width = 80;
+    while (!pool.wait_for(100ms)) {
+        const size_t completed = done.load(std::memory_order_relaxed);
+        const double progress = (num_pixels == 0) ? 1.0 : std::min(static_cast<double>(completed) / static_cast<double>(num_pixels), 1.0);
+        const int filled_bar = static_cast<int>(std::clamp(progress, 0.0, 0.999) * (bar_width + 1));
+
+        std::string bar(bar_width, '.');
+        std::fill_n(bar.begin(), std::min<std::size_t>(filled_bar, bar.size()), '#');
+        const std::string line = std::format("[{}] {:6.2f}%", bar, progress * 100.0);
+        std::cout << "\x1b[2K\r" << line << std::flush;
+    }
+    // Progress completed
+    std::cout << "\x1b[2K\r" << std::format("[{}] {:6.2f}%", std::string(bar_width, '#'), 100.0) << std::endl;
 }
 
-Color Renderer::ray_color(const Ray& ray, const int depth, const Hittable& world) const {
-    HitRecord hit_record;
+void Renderer::measure_scaling(const HittableList& world) const {
+    using clock = std::chrono::steady_clock;
+    Utilities::set_sampler(settings_.sampler);
+    const unsigned max_threads{ThreadPool::shared().size()};
+    const bool pin{ThreadPool::shared().pinned()};
+    const int spp{camera_.num_samples()};
+    const double samples{static_cast<double>(image_width_) * image_height_ * spp};
+
+    // 1, 2, 4, ... threads and the pool's own count, each tracing the same samples of every pixel
+    std::vector<unsigned> thread_counts;
+    for (unsigned threads = 1; threads < max_threads; threads *= 2) {
+        thread_counts.push_back(threads);
+    }
+    thread_counts.push_back(max_threads);
+
+    std::cout << std::format("Scaling over {} spp of {}x{} pixels{}", spp, image_width_, image_height_, pin ? ", pinned" : "") << std::endl;
+    std::cout << std::format("{:>7} {:>9} {:>12} {:>8} {:>10}", "threads", "seconds", "Msamples/s", "speedup", "efficiency") << std::endl;
+    double single_seconds{0};
+    for (const unsigned threads : thread_counts) {
+        ThreadPool::configure(threads, pin);
+        const auto start{clock::now()};
+        for_each_tile(image_width_, image_height_, settings_.tile_size, [&](const ImageTile& tile) {
+            thread_local std::vector<PixelStats> tile_stats;
+            thread_local std::vector<SampleRange> tile_samples;
+            tile_stats.assign(static_cast<size_t>(tile.width) * tile.height, PixelStats{});
+            tile_samples.assign(tile_stats.size(), SampleRange{0, spp});
+            sample_tile(tile, world, tile_samples, tile_stats);
+        }, {}, false);
+        const double seconds{std::chrono::duration<double>(clock::now() - start).count()};
+        if (threads == 1) {
+            single_seconds = seconds;
+        }
+        const double speedup{single_seconds / seconds};
+        std::cout << std::format("{:>7} {:>9.2f} {:>12.2f} {:>7.2f}x {:>9.0f}%", threads, seconds, samples / seconds / 1e6,
+                                 speedup, 100 * speedup / threads) << std::endl;
+    }
+}
+
+void Renderer::sample_tile(const ImageTile& tile, const HittableList& world, const std::span<const SampleRange> samples,
+                           const std::span<PixelStats> stats) const {
+    // The engines see the tile's position in the whole traced image, which keys the random streams
+    const ImageTile traced{tile.x0 + image_x0_, tile.y0 + image_y0_, tile.width, tile.height, tile.index};
+    if (settings_.wavefront) {
+        sample_tile_wavefront(traced, world, samples, stats);
+    } else if (settings_.primary_packets) {
+        sample_tile_packets(traced, world, samples, stats);
+    } else {
+        for (int y = 0; y < tile.height; y++) {
+            for (int x = 0; x < tile.width; x++) {
+                const size_t i{static_cast<size_t>(y) * tile.width + x};
+                stats[i] = sample_pixel(traced.x0 + x, traced.y0 + y, world, samples[i]);
+            }
+        }
+    }
+}
+
+PixelStats Renderer::sample_pixel(const int x, const int y, const HittableList& world, const SampleRange samples) const {
+    PixelStats stats{};
+    for (int sample = samples.first; sample < samples.first + samples.count; sample++) {
+        Utilities::set_random_stream(settings_.seed, x, y, sample, 0);
+        const Ray camera_ray{generate_ray(x, y, settings_.downscale)};
+
+        // Minimum of t = 0 so camera effectively looks forwards (not also backwards)
+        HitRecord camera_hit;
+        rays_traced++;
+        const bool hit{world.ray_hit(camera_ray, Interval{0.001f, std::numeric_limits<float>::max()}, camera_hit)};
+        add_guides(stats, camera_ray, hit ? &camera_hit : nullptr);
+        add_sample(stats, path_color(camera_ray, hit ? &camera_hit : nullptr, world, x, y, sample));
+    }
+    return stats;
+}
+
+void Renderer::sample_tile_packets(const ImageTile& tile, const HittableList& world, const std::span<const SampleRange> samples,
+                                   const std::span<PixelStats> stats) const {
+    constexpr int block{4};     // Packet edge in pixels
+    static_assert(block * block == RayPacket::SIZE);
+    RayPacket packet{};
+    std::array<float, RayPacket::SIZE> t_max{};
+    std::array<HitRecord, RayPacket::SIZE> hits;
+    std::array<int, RayPacket::SIZE> lane_pixel{};     // Tile pixel of each lane, -1 outside the tile
+
+    std::ranges::fill(stats, PixelStats{});
+    for (int block_y = 0; block_y < tile.height; block_y += block) {
+        for (int block_x = 0; block_x < tile.width; block_x += block) {
+            int most_samples{0};
+            for (int lane = 0; lane < RayPacket::SIZE; lane++) {
+                const int x{block_x + lane % block};
+                const int y{block_y + lane / block};
+                lane_pixel[lane] = x < tile.width && y < tile.height ? y * tile.width + x : -1;
+                if (lane_pixel[lane] >= 0) {
+                    most_samples = std::max(most_samples, samples[lane_pixel[lane]].count);
+                }
+            }
+
+            for (int sample = 0; sample < most_samples; sample++) {
+                RayPacket::Mask active{0};
+                for (int lane = 0; lane < RayPacket::SIZE; lane++) {
+                    if (lane_pixel[lane] >= 0 && samples[lane_pixel[lane]].count > sample) {
+                        const int x{tile.x0 + lane_pixel[lane] % tile.width};
+                        const int y{tile.y0 + lane_pixel[lane] / tile.width};
+                        Utilities::set_random_stream(settings_.seed, x, y, samples[lane_pixel[lane]].first + sample, 0);
+                        packet.set(lane, generate_ray(x, y, settings_.downscale));
+                        t_max[lane] = std::numeric_limits<float>::max();
+                        active |= RayPacket::Mask{1} << lane;
+                    }
+                }
+                const RayPacket::Mask hit{world.packet_hit(packet, active, 0.001f, t_max, hits)};
+                rays_traced += std::popcount(active);
 
-    if (depth <= 0) {
-        return {0, 0, 0};
+                for (int lane = 0; lane < RayPacket::SIZE; lane++) {
+                    if (active >> lane & 1) {
+                        add_guides(stats[lane_pixel[lane]], packet.rays[lane], hit >> lane & 1 ? &hits[lane] : nullptr);
+                        add_sample(stats[lane_pixel[lane]], path_color(packet.rays[lane], hit >> lane & 1 ? &hits[lane] : nullptr, world,
+                                                                       tile.x0 + lane_pixel[lane] % tile.width, tile.y0 + lane_pixel[lane] / tile.width,
+                                                                       samples[lane_pixel[lane]].first + sample));
+                    }
+                }
+            }
+        }
+    }
+}
+
+void Renderer::sample_tile_wavefront(const ImageTile& tile, const HittableList& world, const std::span<const SampleRange> samples,
+                                     const std::span<PixelStats> stats) const {
+    // Per-thread batch state, kept between tiles so the queues only allocate once
+    thread_local PathQueue queue;
+    thread_local PathQueue next_queue;
+    thread_local std::vector<HitRecord> hits;
+    thread_local std::vector<uint8_t> did_hit;          // Whether each queued ray hit anything
+    thread_local PathQueue shadow_queue;                // Shadow rays, with the light contribution as their throughput
+    thread_local std::vector<float> shadow_max_t;
+    thread_local std::vector<PathState> paths;
+    thread_local std::vector<uint32_t> path_pixel;      // Tile pixel of each path
+    thread_local std::vector<int> path_sample;          // Sample index of each path within its pixel
+
+    std::ranges::fill(stats, PixelStats{});
+    size_t pixel{0};
+    int pixel_samples{0};       // Samples of the current pixel already generated
+    while (pixel < stats.size()) {
+        // Generate: one camera ray per sample until the batch is full
+        queue.clear();
+        paths.clear();
+        path_pixel.clear();
+        path_sample.clear();
+        while (pixel < stats.size() && queue.size() < WAVEFRONT_MAX_PATHS) {
+            if (pixel_samples >= samples[pixel].count) {
+                pixel++;
+                pixel_samples = 0;
+                continue;
+            }
+            const int x{tile.x0 + static_cast<int>(pixel % tile.width)};
+            const int y{tile.y0 + static_cast<int>(pixel / tile.width)};
+            const int sample{samples[pixel].first + pixel_samples};
+            Utilities::set_random_stream(settings_.seed, x, y, sample, 0);
+            queue.push(generate_ray(x, y, settings_.downscale), Color{1, 1, 1}, static_cast<uint32_t>(paths.size()));
+            paths.emplace_back();
+            path_pixel.push_back(static_cast<uint32_t>(pixel));
+            path_sample.push_back(sample);
+            pixel_samples++;
+        }
+
+        for (int bounce = 0; bounce < RAY_DEPTH && !queue.empty(); bounce++) {
+            // Extend: camera rays are already coherent in pixel order, later bounces are sorted first
+            if (bounce > 0) {
+                queue.sort_coherent(WAVEFRONT_CELL_SIZE);
+            }
+            hits.resize(queue.size());
+            did_hit.resize(queue.size());
+            for (size_t i = 0; i < queue.size(); i++) {
+                did_hit[i] = world.ray_hit(queue.ray(i), Interval{0.001f, std::numeric_limits<float>::max()}, hits[i]);
+                if (bounce == 0) {
+                    add_guides(stats[path_pixel[queue.path(i)]], queue.ray(i), did_hit[i] ? &hits[i] : nullptr);
+                }
+            }
+            rays_traced += queue.size();
+
+            // Shade: every path takes the same per-vertex step as in the depth-first engine, queueing its continuation
+            // and shadow rays
+            next_queue.clear();
+            shadow_queue.clear();
+            shadow_max_t.clear();
+            std::optional<ShadowRay> shadow;
+            for (size_t i = 0; i < queue.size(); i++) {
+                const uint32_t path{queue.path(i)};
+                const uint32_t tile_pixel{path_pixel[path]};
+                Color throughput{queue.throughput(i)};
+                Ray next;
+                const bool continues{shade_vertex(queue.ray(i), did_hit[i] ? &hits[i] : nullptr, tile.x0 + static_cast<int>(tile_pixel % tile.width),
+                                                  tile.y0 + static_cast<int>(tile_pixel / tile.width), path_sample[path], bounce, paths[path], throughput,
+                                                  next, shadow)};
+                if (shadow) {
+                    shadow_queue.push(shadow->ray, shadow->contribution, path);
+                    shadow_max_t.push_back(shadow->max_t);
+                }
+                if (continues) {
+                    next_queue.push(next, throughput, path);
+                }
+            }
+
+            // Connect: trace the shadow rays, unblocked ones add their light to the path
+            for (size_t i = 0; i < shadow_queue.size(); i++) {
+                if (!world.occluded(shadow_queue.ray(i), Interval{0.001f, shadow_max_t[i]})) {
+                    paths[shadow_queue.path(i)].radiance += shadow_queue.throughput(i);
+                }
+            }
+            rays_traced += shadow_queue.size();
+            std::swap(queue, next_queue);
+        }
+
+        // Every path of the batch has ended, add them to their pixels
+        for (size_t path = 0; path < paths.size(); path++) {
+            add_sample(stats[path_pixel[path]], paths[path].radiance);
+        }
     }
+}
+
+Color Renderer::path_color(const Ray& camera_ray, const HitRecord* camera_hit, const Hittable& world, const int x, const int y, const int sample) const {
+    HitRecord hit_record;
+    Ray ray{camera_ray};
+    Color throughput{1, 1, 1};      // Attenuation accumulated along the path so far
+    PathState path;
+    std::optional<ShadowRay> shadow;
 
-    const bool parent_ray{ray.origin() == camera_.position()};
-    // Minimum of t = 0 so camera effectively looks forwards (not also backwards)
-    if (!world.ray_hit(ray, Interval{0.001f, std::numeric_limits<float>::max()}, hit_record)) {
-        if (parent_ray) {
-            // Radial interpolation of sky colors (closer to center = orange, farther = blue)
-            const float lin_y{0.5f * (ray.direction().y() + 1)};
-            float x{0.5f * (ray.direction().x() + 1)};
-            float y{0.5f * (ray.direction().y() + 1)};
-            x -= 0.5f;
-            y -= 0.5f;
+    for (int bounce = 0; bounce < RAY_DEPTH; bounce++) {
+        bool hit;
+        if (bounce == 0) {
+            hit = camera_hit != nullptr;
+            if (hit) {
+                hit_record = *camera_hit;
+            }
+        } else {
+            rays_traced++;
+            hit = world.ray_hit(ray, Interval{0.001f, std::numeric_limits<float>::max()}, hit_record);
+        }
+        Ray next;
+        const bool continues{shade_vertex(ray, hit ? &hit_record : nullptr, x, y, sample, bounce, path, throughput, next, shadow)};
 
-            float a{std::sqrt(x * x + y * y)};
-            a = std::clamp(a / 0.5f, 0.f, 1.f);
-            return (1.f - (a * lin_y)) * ORANGE_BACKGROUND_COLOR + (a * lin_y) * BLUE_BACKGROUND_COLOR;
+        // Next-event estimation: the light sampled from this hit counts if the shadow ray reaches it
+        if (shadow) {
+            rays_traced++;
+            if (!world.occluded(shadow->ray, Interval{0.001f, shadow->max_t})) {
+                path.radiance += shadow->contribution;
+            }
         }
-        return AMBIENT_LIGHT;
+        if (!continues) {
+            break;
+        }
+        ray = next;
     }
+    return path.radiance;
+}
 
-    // Ray-object intersection, generate new child rays in random directions outwards from the surface
-    const Color color_from_emission{hit_record.emitted()};
+bool Renderer::shade_vertex(const Ray& ray, const HitRecord* hit, const int x, const int y, const int sample, const int bounce, PathState& path,
+                            Color& throughput, Ray& next, std::optional<ShadowRay>& shadow) const {
+    shadow.reset();
+    if (hit == nullptr) {
+        path.radiance += throughput * (bounce == 0 ? sky_color(ray) : AMBIENT_LIGHT);     // Only camera rays see the sky gradient
+        return false;
+    }
+
+    // Ray-object intersection, continue the path in a direction depending on the surface's Material. Lights hit
+    // after a diffuse bounce were also sampled directly, so that hit only gets its MIS weight
+    const float emission_weight{path.bsdf_pdf > 0 ? power_heuristic(path.bsdf_pdf, light_pdf(path.light_sample_point, ray.direction())) : 1.f};
+    path.radiance += throughput * hit->emitted() * emission_weight;
+    Utilities::set_random_stream(settings_.seed, x, y, sample, bounce + 1);
     Color attenuation{};
-    Ray next;
-    if (!hit_record.bounce(ray, attenuation, next)) {
-        return color_from_emission;
+    bool diffuse;
+    path.bsdf_pdf = 0;
+    if (!hit->bounce(ray, attenuation, next, diffuse)) {
+        return false;
     }
 
-    return attenuation * ray_color(next, depth - 1, world) + color_from_emission;
+    // Next-event estimation: sample a light from diffuse hits, the engine traces the shadow ray
+    if (diffuse && settings_.light_sampling && !lights_.empty()) {
+        Ray shadow_ray;
+        float max_t;
+        Color direct;
+        if (sample_light(*hit, shadow_ray, max_t, direct)) {
+            shadow = ShadowRay{shadow_ray, max_t, throughput * direct};
+        }
+        const uvec3 normal{hit->front_face() ? hit->normal() : -hit->normal()};
+        path.light_sample_point = hit->point();
+        path.bsdf_pdf = std::max(0.f, dot(next.direction(), normal)) / static_cast<float>(M_PI);
+    }
+    throughput = throughput * attenuation;
+
+    // Russian roulette: past the first few bounces, end dim paths at random and boost the survivors by the same
+    // probability, so the expected radiance is unchanged
+    if (bounce + 1 >= ROULETTE_MIN_BOUNCES) {
+        const float survival{std::min(std::max({throughput.x(), throughput.y(), throughput.z()}), ROULETTE_MAX_SURVIVAL)};
+        Utilities::set_dimension(Utilities::DIMENSION_ROULETTE);
+        if (Utilities::random_float() >= survival) {
+            return false;
+        }
+        throughput /= survival;
+    }
+    return true;
+}
+
+bool Renderer::sample_light(const HitRecord& hit, Ray& shadow_ray, float& max_t, Color& contribution) const {
+    Utilities::set_dimension(Utilities::DIMENSION_LIGHT_SELECT);
+    const Sphere& light{*lights_[std::min(static_cast<size_t>(Utilities::random_float() * static_cast<float>(lights_.size())), lights_.size() - 1)]};
+    float cone_pdf;
+    Utilities::set_dimension(Utilities::DIMENSION_LIGHT);
+    const uvec3 direction{light.sample_cone(hit.point(), cone_pdf)};
+    const uvec3 normal{hit.front_face() ? hit.normal() : -hit.normal()};
+    const float cosine{dot(direction, normal)};
+    if (cone_pdf <= 0 || cosine <= 0) {
+        return false;
+    }
+
+    shadow_ray = Ray{hit.point(), direction};
+    HitRecord light_hit;
+    if (!light.ray_hit(shadow_ray, Interval{0.001f, std::numeric_limits<float>::max()}, light_hit)) {
+        return false;       // Grazing the cone's edge, lost to rounding
+    }
+    max_t = light_hit.t() - 0.001f;
+
+    // Lambertian albedo / pi * emitted * cos / pdf, weighted against the cosine-weighted BSDF sample
+    const float pdf{light_pdf(hit.point(), direction)};
+    const float bsdf_pdf{cosine / static_cast<float>(M_PI)};
+    contribution = hit.material().albedo() * light_hit.emitted() * (bsdf_pdf / pdf * power_heuristic(pdf, bsdf_pdf));
+    return true;
+}
+
+float Renderer::light_pdf(const coord3& from, const uvec3& direction) const {
+    float pdf{0};
+    for (const std::shared_ptr<const Sphere>& light : lights_) {
+        pdf += light->cone_pdf(from, direction);
+    }
+    return pdf / static_cast<float>(lights_.size());
+}
+
+// Radial interpolation of sky colors (closer to center = orange, farther = blue)
+Color Renderer::sky_color(const Ray& ray) {
+    const float lin_y{0.5f * (ray.direction().y() + 1)};
+    float x{0.5f * (ray.direction().x() + 1)};
+    float y{0.5f * (ray.direction().y() + 1)};
+    x -= 0.5f;
+    y -= 0.5f;
+
+    float a{std::sqrt(x * x + y * y)};
+    a = std::clamp(a / 0.5f, 0.f, 1.f);
+    return (1.f - (a * lin_y)) * ORANGE_BACKGROUND_COLOR + (a * lin_y) * BLUE_BACKGROUND_COLOR;
 }
 
 /* Generate a primary ray which influences its pixel's final color.
  * Behavior upon intersection with an object depends on its Material. */
-Ray Renderer::generate_ray(const int x, const int y) const {
+Accumulation Renderer::upsample(const HittableList& world, const std::span<const PixelStats> pixels, std::vector<std::vector<Color>>& images) const {
+    const Upsampler upsampler{image_width_, image_height_, image_x0_, image_y0_, settings_.downscale, pixels, images};
+    const int width{settings_.crop_width};
+    const int height{settings_.crop_height};
+    const size_t num_images{images.size()};
+    const int guide_samples{std::clamp(camera_.num_samples(), 1, MAX_GUIDE_SAMPLES)};   // Antialiased like a render of up to that many spp
+    Accumulation hits{width, height, settings_.seed, 0, std::vector<PixelStats>(static_cast<size_t>(width) * height), settings_.crop_x, settings_.crop_y};
+    std::vector<Color> colors(hits.pixels.size() * num_images);     // Every image's color of a pixel next to each other
+
+    for_each_tile(width, height, settings_.tile_size, [&](const ImageTile& tile) {
+        constexpr int block{4};     // Packet edge in pixels
+        static_assert(block * block == RayPacket::SIZE);
+        RayPacket packet{};
+        std::array<float, RayPacket::SIZE> t_max{};
+        std::array<HitRecord, RayPacket::SIZE> lane_hits;
+        for (int block_y = tile.y0; block_y < tile.y0 + tile.height; block_y += block) {
+            for (int block_x = tile.x0; block_x < tile.x0 + tile.width; block_x += block) {
+                for (int sample = 0; sample < guide_samples; sample++) {
+                    RayPacket::Mask active{0};
+                    for (int lane = 0; lane < RayPacket::SIZE; lane++) {
+                        const int x{block_x + lane % block};
+                        const int y{block_y + lane / block};
+                        if (x < tile.x0 + tile.width && y < tile.y0 + tile.height) {
+                            Utilities::set_random_stream(settings_.seed, settings_.crop_x + x, settings_.crop_y + y, sample, 0);
+                            packet.set(lane, generate_ray(settings_.crop_x + x, settings_.crop_y + y, 1));
+                            t_max[lane] = std::numeric_limits<float>::max();
+                            active |= RayPacket::Mask{1} << lane;
+                        }
+                    }
+                    const RayPacket::Mask hit{world.packet_hit(packet, active, 0.001f, t_max, lane_hits)};
+
+                    for (int lane = 0; lane < RayPacket::SIZE; lane++) {
+                        if (!(active >> lane & 1)) {
+                            continue;
+                        }
+                        const int x{block_x + lane % block};
+                        const int y{block_y + lane / block};
+                        const size_t pixel{static_cast<size_t>(y) * width + x};
+                        const HitRecord* lane_hit{hit >> lane & 1 ? &lane_hits[lane] : nullptr};
+                        add_guides(hits.pixels[pixel], packet.rays[lane], lane_hit);
+                        hits.pixels[pixel].samples++;
+
+                        const std::span<Color> pixel_colors{colors.begin() + static_cast<std::ptrdiff_t>(pixel * num_images), num_images};
+                        if (lane_hit == nullptr) {
+                            for (Color& color : pixel_colors) {
+                                color += sky_color(packet.rays[lane]);
+                            }
+                        } else {
+                            upsampler.add_hit(settings_.crop_x + x, settings_.crop_y + y, lane_hit->material().albedo(), lane_hit->front_face() ? lane_hit->normal() : -lane_hit->normal(),
+                                              lane_hit->t(), pixel_colors);
+                        }
+                    }
+                }
+            }
+        }
+    });
+
+    for (size_t image = 0; image < num_images; image++) {
+        images[image].resize(hits.pixels.size());
+        for (size_t pixel = 0; pixel < hits.pixels.size(); pixel++) {
+            images[image][pixel] = colors[pixel * num_images + image] / static_cast<float>(guide_samples);
+        }
+    }
+    return hits;
+}
+
+Ray Renderer::generate_ray(const int x, const int y, const int scale) const {
+    // All camera dimensions in one go: jitter within the pixel, then the point on the defocus disk if there is one
+    static_assert(Utilities::DIMENSION_LENS == Utilities::DIMENSION_PIXEL + 2);
+    const bool defocus{camera_.defocus_angle() > 0};
+    std::array<float, 4> camera_sample{};
+    Utilities::set_dimension(Utilities::DIMENSION_PIXEL);
+    Utilities::fill(std::span{camera_sample}.first(defocus ? 4 : 2));
+
     // Get a vector to a random point inside the pixel square centered at (i, j)
-    const float random_x{Utilities::random_float()};
-    const float random_y{Utilities::random_float()};
-    const vec3 offset{random_x - 0.5f, random_y - 0.5f, 0};
+    const vec3 offset{camera_sample[0] - 0.5f, camera_sample[1] - 0.5f, 0};
 
-    const coord3 horizontal_offset{(static_cast<float>(x) + offset.x()) * camera_.pixel_delta_u()};
-    const coord3 vertical_offset{(static_cast<float>(y) + offset.y()) * camera_.pixel_delta_v()};
+    // A larger pixel covers scale x scale camera pixels, its center is in the middle of them
+    const float center_shift{0.5f * static_cast<float>(scale - 1)};
+    const coord3 horizontal_offset{((static_cast<float>(x) + offset.x()) * static_cast<float>(scale) + center_shift) * camera_.pixel_delta_u()};
+    const coord3 vertical_offset{((static_cast<float>(y) + offset.y()) * static_cast<float>(scale) + center_shift) * camera_.pixel_delta_v()};
     const coord3 pixel_sample{pixel_0_center_ + horizontal_offset + vertical_offset};
 
-    const coord3 ray_origin{camera_.defocus_angle() <= 0 ? camera_.position() : camera_.defocus_disk_sample()};
+    const coord3 ray_origin{defocus ? camera_.defocus_disk_sample(camera_sample[2], camera_sample[3]) : camera_.position()};
     return {ray_origin, unit(pixel_sample - ray_origin)};
 }
 
-// Writes a complete vector of pixel colors to a .ppm file with optional gamma color correction
 void Renderer::write_to_file(const std::string& filename, const std::vector<Color>& pixels, const bool gamma) const {
-    std::ofstream out{filename, std::ios_base::binary};
-    if (!out) {
-        const std::error_code error{errno, std::generic_category()};
-        throw std::runtime_error("Failed to open output file: " + filename + " (" + error.message() + ")");
-    }
-    out << "P6\n" << image_width_ << ' ' << image_height_ << "\n255\n";
+    write_to_file(filename, image_width_, image_height_, pixels, gamma);
+}
 
-    std::vector<uint8_t> outbuf;
-    outbuf.reserve(pixels.size() * 3);
+// Writes a complete vector of pixel colors to a .ppm file with optional gamma color correction
+void Renderer::write_to_file(const std::string& filename, const int width, const int height, const std::vector<Color>& pixels, const bool gamma) {
+    std::vector<uint8_t> bytes;
+    bytes.reserve(pixels.size() * 3);
     for (const Color& pixel : pixels) {  // 1 byte per color channel
         float r{pixel.x()};
         float g{pixel.y()};
@@ -191,11 +1098,23 @@ void Renderer::write_to_file(const std::string& filename, const std::vector<Colo
             g = std::pow(std::fabs(g), 1 / gm);
             b = std::pow(std::fabs(b), 1 / gm);
         }
-        constexpr Interval color_intensity{0.f, 0.999f};
-        outbuf.push_back(static_cast<uint8_t>(256 * color_intensity.clamp(r)));
-        outbuf.push_back(static_cast<uint8_t>(256 * color_intensity.clamp(g)));
-        outbuf.push_back(static_cast<uint8_t>(256 * color_intensity.clamp(b)));
+        bytes.push_back(to_byte(r));
+        bytes.push_back(to_byte(g));
+        bytes.push_back(to_byte(b));
+    }
+    write_to_file(filename, width, height, bytes);
+}
+
+void Renderer::write_to_file(const std::string& filename, const int width, const int height, const std::vector<uint8_t>& bytes) {
+    std::ofstream out{filename, std::ios_base::binary};
+    if (!out) {
+        const std::error_code error{errno, std::generic_category()};
+        throw std::runtime_error("Failed to open output file: " + filename + " (" + error.message() + ")");
     }
-    out.write(reinterpret_cast<const char*>(outbuf.data()), static_cast<long>(outbuf.size()));
+    out << "P6\n" << width << ' ' << height << "\n255\n";
+    out.write(reinterpret_cast<const char*>(bytes.data()), static_cast<long>(bytes.size()));
     out.close();
+    if (!out) {
+        throw std::runtime_error("Failed to write output file: " + filename);
+    }
 }
\ No newline at end of file
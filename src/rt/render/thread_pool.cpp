@@ -0,0 +1,159 @@
+#include "rt/render/thread_pool.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <utility>
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+std::unique_ptr<ThreadPool> ThreadPool::shared_;
+
+// CPUs this process may run on, in the order workers are pinned to them
+static std::vector<int> allowed_cpus() {
+    std::vector<int> cpus;
+    #ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+        for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+            if (CPU_ISSET(cpu, &set)) {
+                cpus.push_back(cpu);
+            }
+        }
+    }
+    #endif
+    return cpus;
+}
+
+ThreadPool::ThreadPool(const unsigned num_threads, const bool pin) {
+    const unsigned count{num_threads > 0 ? num_threads : available_cpus()};
+    std::vector<int> cpus;
+    if (pin) {
+        cpus = allowed_cpus();
+        if (cpus.empty()) {
+            std::cerr << "Pinning threads is not supported here, leaving them to the OS" << std::endl;
+        }
+    }
+    pinned_ = !cpus.empty();
+
+    threads_.reserve(count);
+    for (unsigned index = 0; index < count; index++) {
+        const int cpu{cpus.empty() ? -1 : cpus[index % cpus.size()]};
+        threads_.emplace_back([this, index, cpu] { work(index, cpu); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::scoped_lock lock{mutex_};
+        stopping_ = true;
+    }
+    job_ready_.notify_all();
+    threads_.clear();   // Joins
+}
+
+void ThreadPool::run(const std::function<void(unsigned)>& job) {
+    start(job);
+    wait();
+}
+
+void ThreadPool::start(const std::function<void(unsigned)>& job) {
+    {
+        std::scoped_lock lock{mutex_};
+        job_ = job;
+        busy_ = size();
+        generation_++;
+    }
+    job_ready_.notify_all();
+}
+
+bool ThreadPool::wait_for(const std::chrono::milliseconds timeout) {
+    std::unique_lock lock{mutex_};
+    if (!job_done_.wait_for(lock, timeout, [this] { return busy_ == 0; })) {
+        return false;
+    }
+    rethrow_error();
+    return true;
+}
+
+void ThreadPool::wait() {
+    std::unique_lock lock{mutex_};
+    job_done_.wait(lock, [this] { return busy_ == 0; });
+    rethrow_error();
+}
+
+void ThreadPool::rethrow_error() {
+    job_ = nullptr;     // Releases what the job captured
+    if (error_) {
+        std::rethrow_exception(std::exchange(error_, nullptr));
+    }
+}
+
+void ThreadPool::work(const unsigned index, const int cpu) {
+    // Pinned before the worker touches any memory, so its thread_local buffers are allocated on its CPU's node
+    #ifdef __linux__
+    if (cpu >= 0) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpu, &set);
+        if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) != 0) {
+            std::cerr << "Could not pin thread " << index << " to CPU " << cpu << std::endl;
+        }
+    }
+    #endif
+
+    std::uint64_t done_generation{0};
+    while (true) {
+        std::function<void(unsigned)>* job;
+        {
+            std::unique_lock lock{mutex_};
+            job_ready_.wait(lock, [&] { return stopping_ || generation_ != done_generation; });
+            if (stopping_) {
+                return;
+            }
+            done_generation = generation_;
+            job = &job_;    // Only replaced by start() once every worker returned
+        }
+
+        std::exception_ptr error;
+        try {
+            (*job)(index);
+        } catch (...) {
+            error = std::current_exception();
+        }
+
+        bool last;
+        {
+            std::scoped_lock lock{mutex_};
+            if (error && !error_) {
+                error_ = error;
+            }
+            last = --busy_ == 0;
+        }
+        if (last) {
+            job_done_.notify_all();
+        }
+    }
+}
+
+ThreadPool& ThreadPool::shared() {
+    if (!shared_) {
+        shared_ = std::make_unique<ThreadPool>();
+    }
+    return *shared_;
+}
+
+void ThreadPool::configure(const unsigned num_threads, const bool pin) {
+    const unsigned count{num_threads > 0 ? num_threads : available_cpus()};
+    if (!shared_ || shared_->size() != count || shared_->pinned() != pin) {
+        shared_.reset();    // Joins the old workers first
+        shared_ = std::make_unique<ThreadPool>(count, pin);
+    }
+}
+
+unsigned ThreadPool::available_cpus() {
+    const std::vector<int> cpus{allowed_cpus()};
+    return cpus.empty() ? std::max(1u, std::thread::hardware_concurrency()) : static_cast<unsigned>(cpus.size());
+}
@@ -0,0 +1,97 @@
+#include "rt/render/tile_scheduler.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+TileScheduler::TileScheduler(const int image_width, const int image_height, const int tile_size, const unsigned num_workers,
+                             const std::vector<double>& tile_costs) :
+    queues_(std::max(1u, num_workers)),
+    num_tiles_{0} {
+    if (tile_size <= 0) {
+        throw std::invalid_argument("TileScheduler tile size must be greater than 0");
+    }
+    const int tiles_x{(image_width + tile_size - 1) / tile_size};
+    const int tiles_y{(image_height + tile_size - 1) / tile_size};
+    num_tiles_ = count_tiles(image_width, image_height, tile_size);
+    if (!tile_costs.empty() && tile_costs.size() != num_tiles_) {
+        throw std::invalid_argument("TileScheduler needs one cost per tile");
+    }
+
+    // Sort key: Morton code, or the negated cost for LPT order
+    std::vector<std::pair<double, ImageTile>> ordered;
+    ordered.reserve(num_tiles_);
+    for (int ty = 0; ty < tiles_y; ty++) {
+        for (int tx = 0; tx < tiles_x; tx++) {
+            const int x0{tx * tile_size};
+            const int y0{ty * tile_size};
+            const std::size_t index{static_cast<std::size_t>(ty) * tiles_x + tx};
+            const double key{tile_costs.empty() ? static_cast<double>(morton_code(tx, ty)) : -tile_costs[index]};
+            ordered.push_back({key, ImageTile{x0, y0, std::min(tile_size, image_width - x0), std::min(tile_size, image_height - y0), index}});
+        }
+    }
+    std::stable_sort(ordered.begin(), ordered.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+    const std::size_t num_queues{queues_.size()};
+    if (!tile_costs.empty()) {
+        // Deal round-robin, every worker starts on one of the most expensive tiles
+        for (std::size_t i = 0; i < num_tiles_; i++) {
+            queues_[i % num_queues].tiles.push_back(ordered[i].second);
+        }
+        return;
+    }
+    // Contiguous runs of the curve per worker, so each starts out on its own region of the image
+    for (std::size_t worker = 0; worker < num_queues; worker++) {
+        const std::size_t begin{num_tiles_ * worker / num_queues};
+        const std::size_t end{num_tiles_ * (worker + 1) / num_queues};
+        for (std::size_t i = begin; i < end; i++) {
+            queues_[worker].tiles.push_back(ordered[i].second);
+        }
+    }
+}
+
+std::size_t TileScheduler::count_tiles(const int image_width, const int image_height, const int tile_size) noexcept {
+    if (image_width <= 0 || image_height <= 0 || tile_size <= 0) {
+        return 0;
+    }
+    return static_cast<std::size_t>((image_width + tile_size - 1) / tile_size) * ((image_height + tile_size - 1) / tile_size);
+}
+
+std::optional<ImageTile> TileScheduler::next(const unsigned worker, const bool steal) {
+    {
+        WorkerQueue& own{queues_[worker]};
+        std::scoped_lock lock{own.mutex};
+        if (!own.tiles.empty()) {
+            const ImageTile tile{own.tiles.front()};
+            own.tiles.pop_front();
+            return tile;
+        }
+    }
+    if (!steal) {
+        return std::nullopt;
+    }
+
+    // Steal from the back, the part of a victim's region it would have reached last
+    const std::size_t num_queues{queues_.size()};
+    for (std::size_t offset = 1; offset < num_queues; offset++) {
+        WorkerQueue& victim{queues_[(worker + offset) % num_queues]};
+        std::scoped_lock lock{victim.mutex};
+        if (!victim.tiles.empty()) {
+            const ImageTile tile{victim.tiles.back()};
+            victim.tiles.pop_back();
+            return tile;
+        }
+    }
+    return std::nullopt;
+}
+
+std::uint64_t TileScheduler::morton_code(const std::uint32_t x, const std::uint32_t y) noexcept {
+    const auto spread = [](std::uint64_t v) {
+        v = (v | (v << 16)) & 0x0000FFFF0000FFFFULL;
+        v = (v | (v << 8)) & 0x00FF00FF00FF00FFULL;
+        v = (v | (v << 4)) & 0x0F0F0F0F0F0F0F0FULL;
+        v = (v | (v << 2)) & 0x3333333333333333ULL;
+        v = (v | (v << 1)) & 0x5555555555555555ULL;
+        return v;
+    };
+    return spread(x) | (spread(y) << 1);
+}
@@ -0,0 +1,86 @@
+#include "rt/render/upsampler.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <stdexcept>
+
+static constexpr int NORMAL_SQUARINGS{5};       // The cosine between normals is raised to the 2^NORMAL_SQUARINGS
+static constexpr float DEPTH_TOLERANCE{0.01f};  // Depth differences always tolerated, relative to the depth
+static constexpr float MIN_WEIGHT{1e-4f};       // Below this total weight no tap is on the hit's surface
+
+Upsampler::Upsampler(const int width, const int height, const int x0, const int y0, const int scale, const std::span<const PixelStats> pixels,
+                     const std::vector<std::vector<Color>>& images) :
+    width_{width},
+    height_{height},
+    x0_{x0},
+    y0_{y0},
+    scale_{scale},
+    guides_{width, height, pixels} {
+    const size_t num_pixels{static_cast<size_t>(width) * height};
+    if (scale < 1 || std::ranges::any_of(images, [num_pixels](const std::vector<Color>& image) { return image.size() != num_pixels; })) {
+        throw std::invalid_argument("Upsampler needs the sums and colors of every pixel of the traced image");
+    }
+    lighting_.assign(images.size(), std::vector<Color>(num_pixels));
+    for (size_t i = 0; i < num_pixels; i++) {
+        if (pixels[i].samples == 0) {
+            continue;
+        }
+        for (size_t image = 0; image < images.size(); image++) {
+            lighting_[image][i] = GuideBuffers::demodulate(images[image][i], guides_.albedo[i]);
+        }
+    }
+}
+
+void Upsampler::add_hit(const int x, const int y, const Color& albedo, const uvec3& normal, const float depth, const std::span<Color> colors) const {
+    // Position of the output pixel's center in the traced pixels, and the first of the taps around it
+    const float tx{(static_cast<float>(x) + 0.5f) / static_cast<float>(scale_) - 0.5f - static_cast<float>(x0_)};
+    const float ty{(static_cast<float>(y) + 0.5f) / static_cast<float>(scale_) - 0.5f - static_cast<float>(y0_)};
+    const int x0{static_cast<int>(std::floor(tx)) - TAPS / 2 + 1};
+    const int y0{static_cast<int>(std::floor(ty)) - TAPS / 2 + 1};
+
+    // Taps on other surfaces are weighted down by the normal and depth, the rest by a tent over the distance. Where
+    // every tap is on another surface (e.g. a thin feature the traced image missed), the most similar one is taken
+    float weight_sum{0};
+    size_t best_tap{static_cast<size_t>(std::clamp(static_cast<int>(std::lround(ty)), 0, height_ - 1)) * width_ +
+                    std::clamp(static_cast<int>(std::lround(tx)), 0, width_ - 1)};
+    float best_similarity{0};
+    const Color remodulation{GuideBuffers::demodulation(albedo)};
+    const auto accumulate = [&](const size_t tap, const float weight) {
+        for (size_t image = 0; image < lighting_.size(); image++) {
+            colors[image] += weight * lighting_[image][tap] * remodulation;
+        }
+    };
+    std::array<std::pair<size_t, float>, TAPS * TAPS> taps{};
+    size_t num_taps{0};
+    for (int py = std::max(0, y0); py < std::min(height_, y0 + TAPS); py++) {
+        for (int px = std::max(0, x0); px < std::min(width_, x0 + TAPS); px++) {
+            const size_t tap{static_cast<size_t>(py) * width_ + px};
+            if (guides_.sky(tap)) {
+                continue;
+            }
+            const float dx{std::fabs(static_cast<float>(px) - tx)};
+            const float dy{std::fabs(static_cast<float>(py) - ty)};
+            const float depth_tolerance{GuideBuffers::SIGMA_DEPTH * guides_.depth_gradient[tap] * (dx + dy) + DEPTH_TOLERANCE * depth};
+            float normal_similarity{std::max(0.f, dot(normal, guides_.normal[tap]))};
+            for (int i = 0; i < NORMAL_SQUARINGS; i++) {
+                normal_similarity *= normal_similarity;
+            }
+            const float similarity{normal_similarity * std::exp(-std::fabs(guides_.depth[tap] - depth) / depth_tolerance)};
+            if (similarity > best_similarity) {
+                best_similarity = similarity;
+                best_tap = tap;
+            }
+            const float weight{similarity * std::max(0.f, 1 - dx / (TAPS / 2)) * std::max(0.f, 1 - dy / (TAPS / 2))};
+            taps[num_taps++] = {tap, weight};
+            weight_sum += weight;
+        }
+    }
+    if (weight_sum < MIN_WEIGHT) {
+        accumulate(best_tap, 1);
+        return;
+    }
+    for (size_t i = 0; i < num_taps; i++) {
+        accumulate(taps[i].first, taps[i].second / weight_sum);
+    }
+}
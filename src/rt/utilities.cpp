@@ -1,15 +1,130 @@
-#include <random>
+#include <array>
+#include <cmath>
 #include "rt/utilities.hpp"
 
 namespace Utilities {
-    static thread_local std::mt19937_64 engine{};
+    // Laine-Karras style hash permutation (Burley's constants): each output bit depends only on the input bits below it
+    static uint32_t laine_karras_permutation(uint32_t x, const uint32_t seed) {
+        x += seed;
+        x ^= x * 0x6c50b47cu;
+        x ^= x * 0xb82f1e52u;
+        x ^= x * 0xc7afe638u;
+        x ^= x * 0x8d22f6e6u;
+        return x;
+    }
+
+    static constexpr uint32_t reverse_bits(uint32_t x) {
+        x = (x << 16) | (x >> 16);
+        x = ((x & 0x00ff00ffu) << 8) | ((x & 0xff00ff00u) >> 8);
+        x = ((x & 0x0f0f0f0fu) << 4) | ((x & 0xf0f0f0f0u) >> 4);
+        x = ((x & 0x33333333u) << 2) | ((x & 0xccccccccu) >> 2);
+        x = ((x & 0x55555555u) << 1) | ((x & 0xaaaaaaaau) >> 1);
+        return x;
+    }
+
+    // Second Sobol dimension (x + 1 as the primitive polynomial) with its bits reversed, XORed together per index
+    // byte. Bit reversal is linear over XOR, so looking up the reversed points directly saves reversing them for
+    // the Owen scramble, which works on reversed bits
+    static constexpr auto SOBOL_1_REVERSED{[] {
+        std::array<uint32_t, 32> directions{};
+        for (uint32_t bit = 0, direction = 1u << 31; bit < 32; bit++, direction ^= direction >> 1) {
+            directions[bit] = reverse_bits(direction);
+        }
+        std::array<std::array<uint32_t, 256>, 4> table{};
+        for (int byte = 0; byte < 4; byte++) {
+            for (uint32_t value = 0; value < 256; value++) {
+                for (int bit = 0; bit < 8; bit++) {
+                    if (value >> bit & 1) {
+                        table[byte][value] ^= directions[8 * byte + bit];
+                    }
+                }
+            }
+        }
+        return table;
+    }()};
+
+    static uint32_t sobol_1_reversed(const uint32_t index) {
+        return SOBOL_1_REVERSED[0][index & 0xff] ^ SOBOL_1_REVERSED[1][index >> 8 & 0xff] ^
+               SOBOL_1_REVERSED[2][index >> 16 & 0xff] ^ SOBOL_1_REVERSED[3][index >> 24];
+    }
+
+    static constexpr uint32_t R2_A1{3242174890u};       // 0.7548776662 (1 / plastic number) as 0.32 fixed point
+    static constexpr uint32_t R2_A2{2447445414u};       // 0.5698402910 (1 / plastic number squared)
+
+    static Sampler active_sampler{Sampler::Independent};
+
     void seed_random_generator(const uint64_t seed) {
-        engine.seed(seed);
+        random_stream.sampler = Sampler::Independent;
+        random_stream.key = mix(seed + GOLDEN_GAMMA);
+        random_stream.dimension = 0;
+    }
+
+    void set_sampler(const Sampler sampler) {
+        active_sampler = sampler;
+    }
+
+    void set_random_stream(const uint64_t seed, const uint32_t x, const uint32_t y, const uint32_t sample, const uint32_t vertex) {
+        // Chain the key parts through the hash so that neighbouring pixels, samples or vertices are unrelated
+        const uint64_t vertex_key{mix(mix(seed + GOLDEN_GAMMA) ^ (vertex + GOLDEN_GAMMA))};
+        const uint64_t pixel_key{mix(vertex_key ^ ((static_cast<uint64_t>(x) << 32 | y) + GOLDEN_GAMMA))};
+        RandomStream& stream{random_stream};
+        stream.sampler = active_sampler;
+        stream.key = mix(pixel_key ^ (sample + GOLDEN_GAMMA));
+        stream.pattern_key = active_sampler == Sampler::BlueNoise ? vertex_key : pixel_key;
+        stream.reversed_sample = reverse_bits(sample);
+        stream.x = x;
+        stream.y = y;
+        stream.dimension = 0;
+        stream.cached_pair = ~0ULL;
+    }
+
+    float low_discrepancy_float(const uint64_t dimension) {
+        RandomStream& stream{random_stream};
+
+        // Padded 2D: each dimension pair draws its own shuffle of the sample indices, so the pairs are
+        // uncorrelated while the first 2^k samples of every pair still form a stratified Sobol net. The shuffle
+        // is an Owen scramble of the index, computed on its reversed bits (which are the first Sobol dimension)
+        if (stream.cached_pair != dimension >> 1) {
+            stream.cached_pair = dimension >> 1;
+            stream.pair_key = mix(stream.pattern_key ^ (stream.cached_pair + GOLDEN_GAMMA));
+            stream.pair_index = reverse_bits(laine_karras_permutation(stream.reversed_sample, static_cast<uint32_t>(stream.pair_key)));
+        }
+        const uint32_t component{static_cast<uint32_t>(dimension & 1)};
+        const uint32_t scramble{static_cast<uint32_t>(stream.pair_key >> 32) ^ (component ? 0x5bd1e995u : 0u)};
+
+        // Sobol point as 0.32 fixed point, with its bits reversed. Owen scrambling flips every bit depending on
+        // the bits above it, which is a Laine-Karras permutation of the reversed bits
+        const uint32_t reversed{component ? sobol_1_reversed(stream.pair_index) : stream.pair_index};
+        uint32_t bits;
+        if (stream.sampler == Sampler::Sobol) {
+            bits = reverse_bits(reversed) ^ static_cast<uint32_t>(mix(scramble));
+        } else {
+            bits = reverse_bits(laine_karras_permutation(reversed, scramble));
+        }
+        if (stream.sampler == Sampler::BlueNoise) {
+            // Toroidal shift by an R2 dither of the pixel coordinates (transposed for the second component),
+            // which spreads the error of neighbouring pixels like blue noise
+            const uint32_t u{component ? stream.y : stream.x};
+            const uint32_t v{component ? stream.x : stream.y};
+            bits += u * R2_A1 + v * R2_A2 + static_cast<uint32_t>(stream.pair_key);
+        }
+        // Top 24 bits, exactly representable, in [0, 1)
+        return static_cast<float>(bits >> 8) * 0x1p-24f;
     }
 
-    float random_float() {
-        thread_local std::uniform_real_distribution distribution(0.f, 1.f);
-        return distribution(engine);
+    void fill(const std::span<float> values) {
+        RandomStream& stream{random_stream};
+        if (stream.sampler != Sampler::Independent) {
+            for (float& value : values) {
+                value = low_discrepancy_float(stream.dimension++);
+            }
+            return;
+        }
+        const uint64_t first{stream.key + (stream.dimension + 1) * GOLDEN_GAMMA};
+        for (size_t i = 0; i < values.size(); i++) {
+            values[i] = static_cast<float>(mix(first + i * GOLDEN_GAMMA) >> 40) * 0x1p-24f;
+        }
+        stream.dimension += values.size();
     }
 
     float random_float(const Interval<float>& range) {
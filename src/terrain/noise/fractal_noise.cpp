@@ -0,0 +1,242 @@
+#include "terrain/noise/fractal_noise.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <stdexcept>
+
+std::size_t NoiseTileCache::KeyHash::operator()(const Key& key) const noexcept {
+    // Boost-style hash combine over every key field
+    std::size_t hash{std::hash<std::uint64_t>{}(key.seed)};
+    const auto combine = [&hash](const std::size_t value) {
+        hash ^= value + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
+    };
+    combine(std::hash<std::uint32_t>{}(std::bit_cast<std::uint32_t>(key.spacing)));
+    combine(std::hash<int>{}(key.tile_x));
+    combine(std::hash<int>{}(key.tile_y));
+    combine(std::hash<bool>{}(key.gradient));
+    return hash;
+}
+
+std::shared_ptr<const NoiseTileCache::Tile> NoiseTileCache::get(const Key& key, const std::function<void(Tile&)>& evaluate) {
+    {
+        std::scoped_lock lock{mutex_};
+        if (const auto it{tiles_.find(key)}; it != tiles_.end()) {
+            return it->second;
+        }
+    }
+
+    // Evaluate outside the lock, a racing thread may do the same work but the first insert wins
+    auto tile{std::make_shared<Tile>(TILE_SIZE * TILE_SIZE * (key.gradient ? 3 : 1))};
+    evaluate(*tile);
+
+    std::scoped_lock lock{mutex_};
+    const auto [it, inserted]{tiles_.try_emplace(key, std::move(tile))};
+    if (inserted) {
+        insertion_order_.push_back(key);
+        while (tiles_.size() > max_tiles_ && !insertion_order_.empty()) {
+            tiles_.erase(insertion_order_.front());
+            insertion_order_.pop_front();
+        }
+    }
+    return it->second;
+}
+
+void NoiseTileCache::clear() {
+    std::scoped_lock lock{mutex_};
+    tiles_.clear();
+    insertion_order_.clear();
+}
+
+std::size_t NoiseTileCache::size() const {
+    std::scoped_lock lock{mutex_};
+    return tiles_.size();
+}
+
+FractalNoise::FractalNoise(const std::uint64_t seed, const FractalSettings& settings, std::shared_ptr<NoiseTileCache> cache) :
+    seed_{seed},
+    settings_{settings},
+    cache_{cache ? std::move(cache) : std::make_shared<NoiseTileCache>()} {
+    if (settings_.octaves < 1) {
+        throw std::invalid_argument("FractalNoise needs at least one octave");
+    }
+    octaves_.reserve(settings_.octaves);
+    for (int octave = 0; octave < settings_.octaves; octave++) {
+        // Octave sums are float anyway, compact tables keep many octaves cache-resident
+        octaves_.emplace_back(seed_ + static_cast<std::uint64_t>(octave), OpenSimplex2S::Storage::Float);
+    }
+}
+
+float FractalNoise::shape(const float noise) const noexcept {
+    switch (settings_.type) {
+    case FractalType::Ridged: {
+        const float ridge{1.f - std::fabs(noise)};
+        return ridge * ridge;
+    }
+    case FractalType::Billow:
+        return std::fabs(noise);
+    case FractalType::Fbm:
+    default:
+        return noise;
+    }
+}
+
+float FractalNoise::shape_slope(const float noise) const noexcept {
+    switch (settings_.type) {
+    case FractalType::Ridged:
+        return noise < 0.f ? 2.f * (1.f + noise) : -2.f * (1.f - noise);
+    case FractalType::Billow:
+        return noise < 0.f ? -1.f : 1.f;
+    case FractalType::Fbm:
+    default:
+        return 1.f;
+    }
+}
+
+float FractalNoise::normalize(const float sum, const float total_amplitude) const noexcept {
+    const float value{sum / total_amplitude};
+    // Ridged and billow octaves are 0 to 1, stretch them to the same -1 to 1 range as fBm
+    return settings_.type == FractalType::Fbm ? value : 2.f * value - 1.f;
+}
+
+float FractalNoise::normalize_scale(const float total_amplitude) const noexcept {
+    return (settings_.type == FractalType::Fbm ? 1.f : 2.f) / total_amplitude;
+}
+
+float FractalNoise::noise2(const double x, const double y) const {
+    float sum{0};
+    float amplitude{1};
+    float total_amplitude{0};
+    double frequency{1};
+    for (const OpenSimplex2S& octave : octaves_) {
+        sum += amplitude * shape(static_cast<float>(octave.noise2(x * frequency, y * frequency)));
+        total_amplitude += amplitude;
+        amplitude *= settings_.gain;
+        frequency *= settings_.lacunarity;
+    }
+    return normalize(sum, total_amplitude);
+}
+
+OpenSimplex2S::Sample2 FractalNoise::noise2_with_gradient(const double x, const double y) const {
+    float sum{0};
+    double sum_dx{0};
+    double sum_dy{0};
+    float amplitude{1};
+    float total_amplitude{0};
+    double frequency{1};
+    for (const OpenSimplex2S& octave : octaves_) {
+        const OpenSimplex2S::Sample2 sample{octave.noise2_with_gradient(x * frequency, y * frequency)};
+        const auto noise{static_cast<float>(sample.value)};
+        // d/dx of amplitude * shape(noise(x * frequency))
+        const double slope{amplitude * shape_slope(noise) * frequency};
+        sum += amplitude * shape(noise);
+        sum_dx += slope * sample.dx;
+        sum_dy += slope * sample.dy;
+        total_amplitude += amplitude;
+        amplitude *= settings_.gain;
+        frequency *= settings_.lacunarity;
+    }
+    const double scale{normalize_scale(total_amplitude)};
+    return {normalize(sum, total_amplitude), sum_dx * scale, sum_dy * scale};
+}
+
+void FractalNoise::fill(const int x0, const int y0, const int width, const int height, const float spacing, const std::span<float> out) const {
+    accumulate(x0, y0, width, height, spacing, out, {}, {});
+}
+
+void FractalNoise::fill_with_gradient(const int x0, const int y0, const int width, const int height, const float spacing,
+                                      const std::span<float> out, const std::span<float> out_dx, const std::span<float> out_dy) const {
+    if (out_dx.size() < out.size() || out_dy.size() < out.size()) {
+        throw std::invalid_argument("FractalNoise::fill_with_gradient derivative outputs are smaller than out");
+    }
+    accumulate(x0, y0, width, height, spacing, out, out_dx, out_dy);
+}
+
+void FractalNoise::accumulate(const int x0, const int y0, const int width, const int height, const float spacing,
+                              const std::span<float> out, const std::span<float> out_dx, const std::span<float> out_dy) const {
+    if (width <= 0 || height <= 0) {
+        return;
+    }
+    const std::size_t count{static_cast<std::size_t>(width) * static_cast<std::size_t>(height)};
+    if (out.size() < count) {
+        throw std::invalid_argument("FractalNoise::fill output is smaller than width * height");
+    }
+    const bool gradient{!out_dx.empty()};
+    constexpr int tile_size{NoiseTileCache::TILE_SIZE};
+    constexpr std::size_t plane{static_cast<std::size_t>(tile_size) * tile_size};
+    std::fill_n(out.begin(), count, 0.f);
+    if (gradient) {
+        std::fill_n(out_dx.begin(), count, 0.f);
+        std::fill_n(out_dy.begin(), count, 0.f);
+    }
+
+    // Tiles overlapping the requested grid window (floor division so negative origins line up too)
+    const auto tile_of = [](const int index) { return index >= 0 ? index / tile_size : -((-index - 1) / tile_size) - 1; };
+    const int first_tile_x{tile_of(x0)};
+    const int first_tile_y{tile_of(y0)};
+    const int last_tile_x{tile_of(x0 + width - 1)};
+    const int last_tile_y{tile_of(y0 + height - 1)};
+
+    float amplitude{1};
+    float total_amplitude{0};
+    float octave_spacing{spacing};
+    for (int octave = 0; octave < settings_.octaves; octave++) {
+        const OpenSimplex2S& noise{octaves_[octave]};
+        for (int tile_y = first_tile_y; tile_y <= last_tile_y; tile_y++) {
+            for (int tile_x = first_tile_x; tile_x <= last_tile_x; tile_x++) {
+                const NoiseTileCache::Key key{seed_ + static_cast<std::uint64_t>(octave), octave_spacing, tile_x, tile_y, gradient};
+                const auto tile{cache_->get(key, [&](NoiseTileCache::Tile& samples) {
+                    // One noise2_Row call per tile row
+                    const double x0{static_cast<double>(tile_x * tile_size) * octave_spacing};
+                    const std::span all{samples};
+                    for (int j = 0; j < tile_size; j++) {
+                        const std::size_t row{static_cast<std::size_t>(j) * tile_size};
+                        const double y{static_cast<double>(tile_y * tile_size + j) * octave_spacing};
+                        if (gradient) {
+                            noise.noise2_Row_with_gradient(x0, y, octave_spacing, all.subspan(row, tile_size),
+                                                           all.subspan(plane + row, tile_size), all.subspan(2 * plane + row, tile_size));
+                        } else {
+                            noise.noise2_Row(x0, y, octave_spacing, all.subspan(row, tile_size));
+                        }
+                    }
+                })};
+
+                // Accumulate the overlap of this tile with the output window
+                const int begin_x{std::max(x0, tile_x * tile_size)};
+                const int end_x{std::min(x0 + width, (tile_x + 1) * tile_size)};
+                const int begin_y{std::max(y0, tile_y * tile_size)};
+                const int end_y{std::min(y0 + height, (tile_y + 1) * tile_size)};
+                for (int y = begin_y; y < end_y; y++) {
+                    const std::size_t src_row{static_cast<std::size_t>(y - tile_y * tile_size) * tile_size};
+                    const std::size_t dst_row{static_cast<std::size_t>(y - y0) * width};
+                    for (int x = begin_x; x < end_x; x++) {
+                        const std::size_t src{src_row + static_cast<std::size_t>(x - tile_x * tile_size)};
+                        const std::size_t dst{dst_row + static_cast<std::size_t>(x - x0)};
+                        const float noise{(*tile)[src]};
+                        out[dst] += amplitude * shape(noise);
+                        if (gradient) {
+                            // Chain through the shaping and the octave's grid spacing (derivatives are per grid step)
+                            const float slope{amplitude * shape_slope(noise) * octave_spacing};
+                            out_dx[dst] += slope * (*tile)[plane + src];
+                            out_dy[dst] += slope * (*tile)[2 * plane + src];
+                        }
+                    }
+                }
+            }
+        }
+        total_amplitude += amplitude;
+        amplitude *= settings_.gain;
+        octave_spacing *= settings_.lacunarity;
+    }
+
+    for (float& value : out.first(count)) {
+        value = normalize(value, total_amplitude);
+    }
+    if (gradient) {
+        const float scale{normalize_scale(total_amplitude)};
+        for (std::size_t i = 0; i < count; i++) {
+            out_dx[i] *= scale;
+            out_dy[i] *= scale;
+        }
+    }
+}
@@ -1,23 +1,13 @@
 #include "../../../include/terrain/noise/opensimplex2s.hpp"
 
-OpenSimplex2S::Grad2 OpenSimplex2S::GRADIENTS_2D[PSIZE] {};
-OpenSimplex2S::Grad3 OpenSimplex2S::GRADIENTS_3D[PSIZE] {};
-OpenSimplex2S::Grad4 OpenSimplex2S::GRADIENTS_4D[PSIZE] {};
-
-OpenSimplex2S::LatticePoint2D OpenSimplex2S::LOOKUP_2D[8 * 4] {};
-OpenSimplex2S::LatticePoint3D OpenSimplex2S::LOOKUP_3D[8] {};
-OpenSimplex2S::LatticePoint3D OpenSimplex2S::LOOKUP_3D_EXTRA[8][13] {};
-OpenSimplex2S::LatticePoint4D OpenSimplex2S::LOOKUP_4D[256][20] {};
-unsigned char OpenSimplex2S::LOOKUP_4D_SIZE[256] {};
-
-OpenSimplex2S::Initializer::Initializer() {
-    initLatticePoints();
-    initGradients();
-}
-
-OpenSimplex2S::Initializer OpenSimplex2S::initializer {};
-
-OpenSimplex2S::OpenSimplex2S(uint64_t seed) {
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+OpenSimplex2S::OpenSimplex2S(uint64_t seed, const Storage storage) : storage(storage) {
     short source[PSIZE] {};
     for (short i = 0; i < PSIZE; i++) {
         source[i] = i;
@@ -29,13 +19,66 @@ OpenSimplex2S::OpenSimplex2S(uint64_t seed) {
             r += i + 1;
         }
         perm[i] = source[r];
-        permGrad2[i] = GRADIENTS_2D[perm[i]];
-        permGrad3[i] = GRADIENTS_3D[perm[i]];
-        permGrad4[i] = GRADIENTS_4D[perm[i]];
         source[r] = source[i];
     }
 }
 
+std::size_t OpenSimplex2S::tableBytes() const {
+    return sizeof(perm) + permGrad2.bytes() + permGrad2f.bytes() + permGrad3.bytes() + permGrad3f.bytes()
+        + permGrad4.bytes() + permGrad4f.bytes();
+}
+
+const OpenSimplex2S::Grad2* OpenSimplex2S::grad2Table() const {
+    return permGrad2.get([this](Grad2* table) {
+        for (int i = 0; i < PSIZE; i++) {
+            table[i] = GRADIENTS_2D[perm[i] % GRADIENTS_2D.size()];
+        }
+    });
+}
+
+const float* OpenSimplex2S::grad2fTable() const {
+    return permGrad2f.get([this](float* table) {
+        for (int i = 0; i < PSIZE; i++) {
+            table[i] = static_cast<float>(GRADIENTS_2D[perm[i] % GRADIENTS_2D.size()].dx);
+            table[PSIZE + i] = static_cast<float>(GRADIENTS_2D[perm[i] % GRADIENTS_2D.size()].dy);
+        }
+    });
+}
+
+const OpenSimplex2S::Grad3* OpenSimplex2S::grad3Table() const {
+    return permGrad3.get([this](Grad3* table) {
+        for (int i = 0; i < PSIZE; i++) {
+            table[i] = GRADIENTS_3D[perm[i] % GRADIENTS_3D.size()];
+        }
+    });
+}
+
+const OpenSimplex2S::Grad3f* OpenSimplex2S::grad3fTable() const {
+    return permGrad3f.get([this](Grad3f* table) {
+        for (int i = 0; i < PSIZE; i++) {
+            const Grad3& grad = GRADIENTS_3D[perm[i] % GRADIENTS_3D.size()];
+            table[i] = { static_cast<float>(grad.dx), static_cast<float>(grad.dy), static_cast<float>(grad.dz) };
+        }
+    });
+}
+
+const OpenSimplex2S::Grad4* OpenSimplex2S::grad4Table() const {
+    return permGrad4.get([this](Grad4* table) {
+        for (int i = 0; i < PSIZE; i++) {
+            table[i] = GRADIENTS_4D[perm[i] % GRADIENTS_4D.size()];
+        }
+    });
+}
+
+const OpenSimplex2S::Grad4f* OpenSimplex2S::grad4fTable() const {
+    return permGrad4f.get([this](Grad4f* table) {
+        for (int i = 0; i < PSIZE; i++) {
+            const Grad4& grad = GRADIENTS_4D[perm[i] % GRADIENTS_4D.size()];
+            table[i] = { static_cast<float>(grad.dx), static_cast<float>(grad.dy), static_cast<float>(grad.dz), static_cast<float>(grad.dw) };
+        }
+    });
+}
+
 // 2D SuperSimplex noise, standard lattice orientation
 double OpenSimplex2S::noise2(const double x, const double y) const {
     // Get points for A2* lattice
@@ -80,6 +123,9 @@ double OpenSimplex2S::noise2_Base(const double xs, const double ys) const {
     const double xi = xsi + ssi;
     const double yi = ysi + ssi;
 
+    const Grad2* grads = storage == Storage::Double ? grad2Table() : nullptr;
+    const float* gradsf = grads ? nullptr : grad2fTable();
+
     // Point contributions
     for (int i = 0; i < 4; i++) {
         const LatticePoint2D c = LOOKUP_2D[index + i];
@@ -93,8 +139,9 @@ double OpenSimplex2S::noise2_Base(const double xs, const double ys) const {
 
         const int pxm = (xsb + c.xsv) & PMASK;
         const int pym = (ysb + c.ysv) & PMASK;
-        Grad2 grad = permGrad2[perm[pxm] ^ pym];
-        const double extrapolation = grad.dx * dx + grad.dy * dy;
+        const int gi = perm[pxm] ^ pym;
+        const double extrapolation = grads ? grads[gi].dx * dx + grads[gi].dy * dy
+                                           : gradsf[gi] * dx + gradsf[PSIZE + gi] * dy;
 
         attn *= attn;
         value += attn * attn * extrapolation;
@@ -103,6 +150,534 @@ double OpenSimplex2S::noise2_Base(const double xs, const double ys) const {
   return value;
 }
 
+/**
+ * 2D SuperSimplex noise base, with derivatives.
+ * Each point contributes attn^4 * (g . d) with attn = 2/3 - |d|^2, whose derivative
+ * with respect to d is attn^4 * g - 8 * attn^3 * (g . d) * d.
+ */
+OpenSimplex2S::Sample2 OpenSimplex2S::noise2_BaseGradient(const double xs, const double ys) const {
+    Sample2 sample;
+
+    // Get base points and offsets
+    const int xsb = fastFloor(xs);
+    const int ysb = fastFloor(ys);
+    const double xsi = xs - xsb;
+    const double ysi = ys - ysb;
+
+    // Index to point list
+    const int a = static_cast<int>(xsi + ysi);
+    const int index = a << 2 | static_cast<int>(xsi - ysi / 2 + 1 - a / 2.0) << 3 | static_cast<int>(ysi - xsi / 2 + 1 - a / 2.0) << 4;
+
+    const double ssi = (xsi + ysi) * -0.211324865405187;
+    const double xi = xsi + ssi;
+    const double yi = ysi + ssi;
+
+    const Grad2* grads = storage == Storage::Double ? grad2Table() : nullptr;
+    const float* gradsf = grads ? nullptr : grad2fTable();
+
+    // Point contributions
+    for (int i = 0; i < 4; i++) {
+        const LatticePoint2D c = LOOKUP_2D[index + i];
+
+        const double dx = xi + c.dx;
+        const double dy = yi + c.dy;
+        const double attn = 2.0 / 3.0 - dx * dx - dy * dy;
+        if (attn <= 0) {
+            continue;
+        }
+
+        const int pxm = (xsb + c.xsv) & PMASK;
+        const int pym = (ysb + c.ysv) & PMASK;
+        const int gi = perm[pxm] ^ pym;
+        const double gx = grads ? grads[gi].dx : gradsf[gi];
+        const double gy = grads ? grads[gi].dy : gradsf[PSIZE + gi];
+        const double extrapolation = gx * dx + gy * dy;
+
+        const double attn2 = attn * attn;
+        const double attn4 = attn2 * attn2;
+        const double falloff = -8 * attn2 * attn * extrapolation;
+        sample.value += attn4 * extrapolation;
+        sample.dx += attn4 * gx + falloff * dx;
+        sample.dy += attn4 * gy + falloff * dy;
+    }
+    return sample;
+}
+
+// 2D SuperSimplex noise, standard lattice orientation, over a batch of points
+void OpenSimplex2S::noise2(const std::span<const float> xs, const std::span<const float> ys, const std::span<float> out) const {
+    if (xs.size() != ys.size() || xs.size() != out.size()) {
+        throw std::invalid_argument("noise2 batch: xs, ys and out must be the same length");
+    }
+    const std::size_t count = out.size();
+    std::size_t i = 0;
+    if constexpr (BATCH_WIDTH_F > 1) {
+        for (; i + BATCH_WIDTH_F <= count; i += BATCH_WIDTH_F) {
+            noise2_Batch(&xs[i], &ys[i], &out[i]);
+        }
+    }
+    // Scalar tail
+    for (; i < count; i++) {
+        out[i] = static_cast<float>(noise2(xs[i], ys[i]));
+    }
+}
+
+// 2D SuperSimplex noise, standard lattice orientation, over a batch of points (double precision)
+void OpenSimplex2S::noise2(const std::span<const double> xs, const std::span<const double> ys, const std::span<double> out) const {
+    if (xs.size() != ys.size() || xs.size() != out.size()) {
+        throw std::invalid_argument("noise2 batch: xs, ys and out must be the same length");
+    }
+    const std::size_t count = out.size();
+    std::size_t i = 0;
+    if constexpr (BATCH_WIDTH_D > 1) {
+        for (; i + BATCH_WIDTH_D <= count; i += BATCH_WIDTH_D) {
+            noise2_Batch(&xs[i], &ys[i], &out[i]);
+        }
+    }
+    // Scalar tail
+    for (; i < count; i++) {
+        out[i] = noise2(xs[i], ys[i]);
+    }
+}
+
+// 2D SuperSimplex noise, standard lattice orientation, with derivatives
+OpenSimplex2S::Sample2 OpenSimplex2S::noise2_with_gradient(const double x, const double y) const {
+    // The skew below and the unskew inside noise2_Base cancel out, so the
+    // lattice-space derivatives are already the derivatives in (x, y)
+    const double s = 0.366025403784439 * (x + y);
+    return noise2_BaseGradient(x + s, y + s);
+}
+
+// 2D SuperSimplex noise, standard lattice orientation, with derivatives over a batch of points
+void OpenSimplex2S::noise2_with_gradient(const std::span<const float> xs, const std::span<const float> ys, const std::span<float> out,
+                                         const std::span<float> out_dx, const std::span<float> out_dy) const {
+    if (xs.size() != ys.size() || xs.size() != out.size() || out.size() != out_dx.size() || out.size() != out_dy.size()) {
+        throw std::invalid_argument("noise2_with_gradient batch: xs, ys, out, out_dx and out_dy must be the same length");
+    }
+    const std::size_t count = out.size();
+    std::size_t i = 0;
+    if constexpr (BATCH_WIDTH_F > 1) {
+        for (; i + BATCH_WIDTH_F <= count; i += BATCH_WIDTH_F) {
+            noise2_Batch(&xs[i], &ys[i], &out[i], &out_dx[i], &out_dy[i]);
+        }
+    }
+    // Scalar tail
+    for (; i < count; i++) {
+        const Sample2 sample = noise2_with_gradient(xs[i], ys[i]);
+        out[i] = static_cast<float>(sample.value);
+        out_dx[i] = static_cast<float>(sample.dx);
+        out_dy[i] = static_cast<float>(sample.dy);
+    }
+}
+
+// 2D SuperSimplex noise, standard lattice orientation, along an evenly spaced row
+void OpenSimplex2S::noise2_Row(const double x0, const double y, const double step, const std::span<float> out) const {
+    noise2_RowImpl<false>(x0, y, step, out.data(), nullptr, nullptr, out.size());
+}
+
+// 2D SuperSimplex noise, standard lattice orientation, with derivatives along an evenly spaced row
+void OpenSimplex2S::noise2_Row_with_gradient(const double x0, const double y, const double step, const std::span<float> out,
+                                             const std::span<float> out_dx, const std::span<float> out_dy) const {
+    if (out.size() != out_dx.size() || out.size() != out_dy.size()) {
+        throw std::invalid_argument("noise2_Row_with_gradient: out, out_dx and out_dy must be the same length");
+    }
+    noise2_RowImpl<true>(x0, y, step, out.data(), out_dx.data(), out_dy.data(), out.size());
+}
+
+/*
+ * Row evaluator.
+ * Every lattice point LOOKUP_2D can select for a cell with base (xsb, ysb) is one of the eight
+ * slots below. The row is split into runs of samples sharing a cell, the eight gradients are
+ * fetched once per run, and each sample picks its four points by slot, the same way the batch
+ * kernels pick them (point 2 = (2 * b3 - 1 + a, a), point 3 = (a, 2 * b4 - 1 + a)):
+ *   point 2 slot = a ? (b3 ? 4 : 5) : (b3 ? 3 : 2)
+ *   point 3 slot = a ? (b4 ? 7 : 3) : (b4 ? 5 : 6)
+ * Only used without the AVX2/AVX-512 batch kernels: their gathers beat it on those builds, so
+ * there the row is handed to them instead.
+ */
+namespace {
+    constexpr int ROW_SLOTS = 8;
+    constexpr int ROW_SLOT_XSV[ROW_SLOTS] { 0, 1, -1, 1, 2, 0, 0, 1 };
+    constexpr int ROW_SLOT_YSV[ROW_SLOTS] { 0, 1, 0, 0, 1, 1, -1, 2 };
+    constexpr std::size_t ROW_CHUNK = 256;    // A multiple of the batch widths, so only the row's end takes the scalar tail
+
+    /**
+     * Per-cell data of one run: gradient and (negated, unskewed) offset of each slot.
+     */
+    struct RowCell {
+        float gx[ROW_SLOTS];
+        float gy[ROW_SLOTS];
+        float dx[ROW_SLOTS];
+        float dy[ROW_SLOTS];
+    };
+
+    template <bool Gradient>
+    void rowRun(const RowCell& cell, const float* xsiIn, const float* ysiIn, const std::size_t count,
+                float* value, float* valueDx, float* valueDy) {
+        for (std::size_t j = 0; j < count; j++) {
+            const float xsi = xsiIn[j];
+            const float ysi = ysiIn[j];
+            const bool a = xsi + ysi >= 1;
+            const float ha = a ? 0.5f : 0.f;
+            const bool b3 = xsi - ysi * 0.5f - ha >= 0;
+            const bool b4 = ysi - xsi * 0.5f - ha >= 0;
+            const int slots[4] { 0, 1, a ? (b3 ? 4 : 5) : (b3 ? 3 : 2), a ? (b4 ? 7 : 3) : (b4 ? 5 : 6) };
+
+            const float ssi = (xsi + ysi) * -0.211324865405187f;
+            const float xi = xsi + ssi;
+            const float yi = ysi + ssi;
+
+            float sum = 0;
+            float sumDx = 0;
+            float sumDy = 0;
+            for (const int slot : slots) {
+                const float dx = xi + cell.dx[slot];
+                const float dy = yi + cell.dy[slot];
+                const float attn = 2.f / 3.f - dx * dx - dy * dy;
+                if (attn <= 0) {
+                    continue;
+                }
+                const float extrapolation = cell.gx[slot] * dx + cell.gy[slot] * dy;
+                const float attn2 = attn * attn;
+                const float attn4 = attn2 * attn2;
+                sum += attn4 * extrapolation;
+                if constexpr (Gradient) {
+                    const float falloff = -8.f * attn2 * attn * extrapolation;
+                    sumDx += attn4 * cell.gx[slot] + falloff * dx;
+                    sumDy += attn4 * cell.gy[slot] + falloff * dy;
+                }
+            }
+            value[j] = sum;
+            if constexpr (Gradient) {
+                valueDx[j] = sumDx;
+                valueDy[j] = sumDy;
+            }
+        }
+    }
+}
+
+template <bool Gradient>
+void OpenSimplex2S::noise2_RowImpl(const double x0, const double y, const double step, float* out, float* out_dx, float* out_dy,
+                                   const std::size_t count) const {
+    if constexpr (BATCH_WIDTH_F > 1) {
+        // Grid coordinates rounded to float once, as callers filling xs and ys for the batched noise2 would
+        alignas(64) float xs[ROW_CHUNK], ys[ROW_CHUNK];
+        std::fill_n(ys, ROW_CHUNK, static_cast<float>(y));
+        for (std::size_t begin = 0; begin < count; begin += ROW_CHUNK) {
+            const std::size_t n = std::min(ROW_CHUNK, count - begin);
+            for (std::size_t k = 0; k < n; k++) {
+                xs[k] = static_cast<float>(x0 + static_cast<double>(begin + k) * step);
+            }
+            if constexpr (Gradient) {
+                noise2_with_gradient(std::span{xs, n}, std::span{ys, n}, std::span{out + begin, n},
+                                     std::span{out_dx + begin, n}, std::span{out_dy + begin, n});
+            } else {
+                noise2(std::span<const float>{xs, n}, std::span<const float>{ys, n}, std::span{out + begin, n});
+            }
+        }
+        return;
+    }
+
+    const Grad2* grads = storage == Storage::Double ? grad2Table() : nullptr;
+    const float* gradsf = grads ? nullptr : grad2fTable();
+
+    RowCell cell;
+    for (int p = 0; p < ROW_SLOTS; p++) {
+        const LatticePoint2D c(ROW_SLOT_XSV[p], ROW_SLOT_YSV[p]);
+        cell.dx[p] = static_cast<float>(c.dx);
+        cell.dy[p] = static_cast<float>(c.dy);
+    }
+
+    float xsi[ROW_CHUNK], ysi[ROW_CHUNK];
+    int xsb[ROW_CHUNK], ysb[ROW_CHUNK];
+    for (std::size_t begin = 0; begin < count; begin += ROW_CHUNK) {
+        const std::size_t n = std::min(ROW_CHUNK, count - begin);
+
+        // Skew each sample into its cell, same arithmetic as noise2
+        for (std::size_t k = 0; k < n; k++) {
+            const double x = x0 + static_cast<double>(begin + k) * step;
+            const double s = 0.366025403784439 * (x + y);
+            const double xs = x + s;
+            const double ys = y + s;
+            xsb[k] = fastFloor(xs);
+            ysb[k] = fastFloor(ys);
+            xsi[k] = static_cast<float>(xs - xsb[k]);
+            ysi[k] = static_cast<float>(ys - ysb[k]);
+        }
+
+        // Runs of consecutive samples sharing a cell
+        for (std::size_t k = 0; k < n;) {
+            const int cellX = xsb[k];
+            const int cellY = ysb[k];
+            std::size_t end = k + 1;
+            while (end < n && xsb[end] == cellX && ysb[end] == cellY) {
+                end++;
+            }
+
+            for (int p = 0; p < ROW_SLOTS; p++) {
+                const int pxm = (cellX + ROW_SLOT_XSV[p]) & PMASK;
+                const int pym = (cellY + ROW_SLOT_YSV[p]) & PMASK;
+                const int gi = perm[pxm] ^ pym;
+                cell.gx[p] = grads ? static_cast<float>(grads[gi].dx) : gradsf[gi];
+                cell.gy[p] = grads ? static_cast<float>(grads[gi].dy) : gradsf[PSIZE + gi];
+            }
+            rowRun<Gradient>(cell, xsi + k, ysi + k, end - k, out + begin + k,
+                             Gradient ? out_dx + begin + k : nullptr, Gradient ? out_dy + begin + k : nullptr);
+            k = end;
+        }
+    }
+}
+
+/*
+ * Batched 2D kernels.
+ * LOOKUP_2D[index + i] always holds (0, 0) and (1, 1) for i = 0, 1. For i = 2, 3, with
+ * a = (xsi + ysi >= 1) and b3, b4 the two remaining index bits, initLatticePoints() yields
+ *   point 2 = (2 * b3 - 1 + a, a)
+ *   point 3 = (a, 2 * b4 - 1 + a)
+ * so the kernels build those offsets with arithmetic instead of a lookup gather.
+ * The derivatives follow noise2_BaseGradient.
+ */
+#if defined(__AVX512F__)
+void OpenSimplex2S::noise2_Batch(const float* x, const float* y, float* out, float* out_dx, float* out_dy) const {
+    const __m512 xv = _mm512_loadu_ps(x);
+    const __m512 yv = _mm512_loadu_ps(y);
+
+    // Get points for A2* lattice
+    const __m512 s = _mm512_mul_ps(_mm512_add_ps(xv, yv), _mm512_set1_ps(0.366025403784439f));
+    const __m512 xs = _mm512_add_ps(xv, s);
+    const __m512 ys = _mm512_add_ps(yv, s);
+
+    // Get base points and offsets
+    // (masked forms throughout: the unmasked ones trip -Wuninitialized inside GCC 12's own headers)
+    constexpr __mmask16 all = 0xFFFF;
+    const __m512i izero = _mm512_setzero_si512();
+    const __m512 xsf = _mm512_mask_roundscale_ps(xs, all, xs, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+    const __m512 ysf = _mm512_mask_roundscale_ps(ys, all, ys, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+    const __m512i xsb = _mm512_mask_cvttps_epi32(izero, all, xsf);
+    const __m512i ysb = _mm512_mask_cvttps_epi32(izero, all, ysf);
+    const __m512 xsi = _mm512_sub_ps(xs, xsf);
+    const __m512 ysi = _mm512_sub_ps(ys, ysf);
+
+    // Index bits (see above)
+    const __m512 half = _mm512_set1_ps(0.5f);
+    const __m512 one = _mm512_set1_ps(1.f);
+    const __m512 zero = _mm512_setzero_ps();
+    const __m512 a = _mm512_maskz_mov_ps(_mm512_cmp_ps_mask(_mm512_add_ps(xsi, ysi), one, _CMP_GE_OQ), one);
+    const __m512 ha = _mm512_mul_ps(a, half);
+    const __m512 b3 = _mm512_maskz_mov_ps(_mm512_cmp_ps_mask(_mm512_sub_ps(_mm512_fnmadd_ps(ysi, half, xsi), ha), zero, _CMP_GE_OQ), one);
+    const __m512 b4 = _mm512_maskz_mov_ps(_mm512_cmp_ps_mask(_mm512_sub_ps(_mm512_fnmadd_ps(xsi, half, ysi), ha), zero, _CMP_GE_OQ), one);
+
+    const __m512 ssi = _mm512_mul_ps(_mm512_add_ps(xsi, ysi), _mm512_set1_ps(-0.211324865405187f));
+    const __m512 xi = _mm512_add_ps(xsi, ssi);
+    const __m512 yi = _mm512_add_ps(ysi, ssi);
+
+    const __m512 p2x = _mm512_add_ps(_mm512_fmsub_ps(b3, _mm512_set1_ps(2.f), one), a);
+    const __m512 p3y = _mm512_add_ps(_mm512_fmsub_ps(b4, _mm512_set1_ps(2.f), one), a);
+    const __m512 xsv[4] { zero, one, p2x, a };
+    const __m512 ysv[4] { zero, one, a, p3y };
+
+    // Point contributions
+    const float* grads = grad2fTable();
+    const __m512i pmask = _mm512_set1_epi32(PMASK);
+    __m512 value = zero;
+    __m512 gradx = zero;
+    __m512 grady = zero;
+    for (int i = 0; i < 4; i++) {
+        const __m512 ssv = _mm512_mul_ps(_mm512_add_ps(xsv[i], ysv[i]), _mm512_set1_ps(0.211324865405187f));
+        const __m512 dx = _mm512_add_ps(_mm512_sub_ps(xi, xsv[i]), ssv);
+        const __m512 dy = _mm512_add_ps(_mm512_sub_ps(yi, ysv[i]), ssv);
+        const __m512 attn = _mm512_fnmadd_ps(dy, dy, _mm512_fnmadd_ps(dx, dx, _mm512_set1_ps(2.f / 3.f)));
+        const __mmask16 live = _mm512_cmp_ps_mask(attn, zero, _CMP_GT_OQ);
+        if (live == 0) {
+            continue;
+        }
+
+        const __m512i pxm = _mm512_and_si512(_mm512_add_epi32(xsb, _mm512_mask_cvttps_epi32(izero, all, xsv[i])), pmask);
+        const __m512i pym = _mm512_and_si512(_mm512_add_epi32(ysb, _mm512_mask_cvttps_epi32(izero, all, ysv[i])), pmask);
+        const __m512i hash = _mm512_xor_si512(_mm512_mask_i32gather_epi32(izero, live, pxm, perm, 4), pym);
+        const __m512 gx = _mm512_mask_i32gather_ps(zero, live, hash, grads, 4);
+        const __m512 gy = _mm512_mask_i32gather_ps(zero, live, hash, grads + PSIZE, 4);
+        const __m512 extrapolation = _mm512_fmadd_ps(gy, dy, _mm512_mul_ps(gx, dx));
+
+        const __m512 attn2 = _mm512_mul_ps(attn, attn);
+        const __m512 attn4 = _mm512_mul_ps(attn2, attn2);
+        value = _mm512_mask3_fmadd_ps(attn4, extrapolation, value, live);
+        if (out_dx) {
+            const __m512 falloff = _mm512_mul_ps(_mm512_mul_ps(attn2, attn), _mm512_mul_ps(extrapolation, _mm512_set1_ps(-8.f)));
+            gradx = _mm512_mask3_fmadd_ps(falloff, dx, _mm512_mask3_fmadd_ps(attn4, gx, gradx, live), live);
+            grady = _mm512_mask3_fmadd_ps(falloff, dy, _mm512_mask3_fmadd_ps(attn4, gy, grady, live), live);
+        }
+    }
+    _mm512_storeu_ps(out, value);
+    if (out_dx) {
+        _mm512_storeu_ps(out_dx, gradx);
+        _mm512_storeu_ps(out_dy, grady);
+    }
+}
+#elif defined(__AVX2__)
+void OpenSimplex2S::noise2_Batch(const float* x, const float* y, float* out, float* out_dx, float* out_dy) const {
+    const __m256 xv = _mm256_loadu_ps(x);
+    const __m256 yv = _mm256_loadu_ps(y);
+
+    // Get points for A2* lattice
+    const __m256 s = _mm256_mul_ps(_mm256_add_ps(xv, yv), _mm256_set1_ps(0.366025403784439f));
+    const __m256 xs = _mm256_add_ps(xv, s);
+    const __m256 ys = _mm256_add_ps(yv, s);
+
+    // Get base points and offsets
+    const __m256 xsf = _mm256_floor_ps(xs);
+    const __m256 ysf = _mm256_floor_ps(ys);
+    const __m256i xsb = _mm256_cvttps_epi32(xsf);
+    const __m256i ysb = _mm256_cvttps_epi32(ysf);
+    const __m256 xsi = _mm256_sub_ps(xs, xsf);
+    const __m256 ysi = _mm256_sub_ps(ys, ysf);
+
+    // Index bits (see above)
+    const __m256 half = _mm256_set1_ps(0.5f);
+    const __m256 one = _mm256_set1_ps(1.f);
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 a = _mm256_and_ps(_mm256_cmp_ps(_mm256_add_ps(xsi, ysi), one, _CMP_GE_OQ), one);
+    const __m256 ha = _mm256_mul_ps(a, half);
+    const __m256 b3 = _mm256_and_ps(_mm256_cmp_ps(_mm256_sub_ps(_mm256_sub_ps(xsi, _mm256_mul_ps(ysi, half)), ha), zero, _CMP_GE_OQ), one);
+    const __m256 b4 = _mm256_and_ps(_mm256_cmp_ps(_mm256_sub_ps(_mm256_sub_ps(ysi, _mm256_mul_ps(xsi, half)), ha), zero, _CMP_GE_OQ), one);
+
+    const __m256 ssi = _mm256_mul_ps(_mm256_add_ps(xsi, ysi), _mm256_set1_ps(-0.211324865405187f));
+    const __m256 xi = _mm256_add_ps(xsi, ssi);
+    const __m256 yi = _mm256_add_ps(ysi, ssi);
+
+    const __m256 p2x = _mm256_add_ps(_mm256_sub_ps(_mm256_add_ps(b3, b3), one), a);
+    const __m256 p3y = _mm256_add_ps(_mm256_sub_ps(_mm256_add_ps(b4, b4), one), a);
+    const __m256 xsv[4] { zero, one, p2x, a };
+    const __m256 ysv[4] { zero, one, a, p3y };
+
+    // Point contributions
+    const float* grads = grad2fTable();
+    const __m256i pmask = _mm256_set1_epi32(PMASK);
+    __m256 value = zero;
+    __m256 gradx = zero;
+    __m256 grady = zero;
+    for (int i = 0; i < 4; i++) {
+        const __m256 ssv = _mm256_mul_ps(_mm256_add_ps(xsv[i], ysv[i]), _mm256_set1_ps(0.211324865405187f));
+        const __m256 dx = _mm256_add_ps(_mm256_sub_ps(xi, xsv[i]), ssv);
+        const __m256 dy = _mm256_add_ps(_mm256_sub_ps(yi, ysv[i]), ssv);
+        const __m256 attn = _mm256_sub_ps(_mm256_sub_ps(_mm256_set1_ps(2.f / 3.f), _mm256_mul_ps(dx, dx)), _mm256_mul_ps(dy, dy));
+        const __m256 live = _mm256_cmp_ps(attn, zero, _CMP_GT_OQ);
+        if (_mm256_movemask_ps(live) == 0) {
+            continue;
+        }
+
+        const __m256i pxm = _mm256_and_si256(_mm256_add_epi32(xsb, _mm256_cvttps_epi32(xsv[i])), pmask);
+        const __m256i pym = _mm256_and_si256(_mm256_add_epi32(ysb, _mm256_cvttps_epi32(ysv[i])), pmask);
+        const __m256i hash = _mm256_xor_si256(
+            _mm256_mask_i32gather_epi32(_mm256_setzero_si256(), perm, pxm, _mm256_castps_si256(live), 4), pym);
+        const __m256 gx = _mm256_mask_i32gather_ps(zero, grads, hash, live, 4);
+        const __m256 gy = _mm256_mask_i32gather_ps(zero, grads + PSIZE, hash, live, 4);
+        const __m256 extrapolation = _mm256_add_ps(_mm256_mul_ps(gx, dx), _mm256_mul_ps(gy, dy));
+
+        const __m256 attn2 = _mm256_and_ps(_mm256_mul_ps(attn, attn), live);
+        const __m256 attn4 = _mm256_mul_ps(attn2, attn2);
+        value = _mm256_add_ps(value, _mm256_mul_ps(attn4, extrapolation));
+        if (out_dx) {
+            const __m256 falloff = _mm256_mul_ps(_mm256_mul_ps(attn2, attn), _mm256_mul_ps(extrapolation, _mm256_set1_ps(-8.f)));
+            gradx = _mm256_add_ps(gradx, _mm256_add_ps(_mm256_mul_ps(attn4, gx), _mm256_mul_ps(falloff, dx)));
+            grady = _mm256_add_ps(grady, _mm256_add_ps(_mm256_mul_ps(attn4, gy), _mm256_mul_ps(falloff, dy)));
+        }
+    }
+    _mm256_storeu_ps(out, value);
+    if (out_dx) {
+        _mm256_storeu_ps(out_dx, gradx);
+        _mm256_storeu_ps(out_dy, grady);
+    }
+}
+#else
+void OpenSimplex2S::noise2_Batch(const float* x, const float* y, float* out, float* out_dx, float* out_dy) const {
+    if (out_dx) {
+        const Sample2 sample = noise2_with_gradient(*x, *y);
+        *out = static_cast<float>(sample.value);
+        *out_dx = static_cast<float>(sample.dx);
+        *out_dy = static_cast<float>(sample.dy);
+    } else {
+        *out = static_cast<float>(noise2(*x, *y));
+    }
+}
+#endif
+
+#if defined(__AVX2__)
+void OpenSimplex2S::noise2_Batch(const double* x, const double* y, double* out) const {
+    const __m256d xv = _mm256_loadu_pd(x);
+    const __m256d yv = _mm256_loadu_pd(y);
+
+    // Get points for A2* lattice
+    const __m256d s = _mm256_mul_pd(_mm256_add_pd(xv, yv), _mm256_set1_pd(0.366025403784439));
+    const __m256d xs = _mm256_add_pd(xv, s);
+    const __m256d ys = _mm256_add_pd(yv, s);
+
+    // Get base points and offsets
+    const __m256d xsf = _mm256_floor_pd(xs);
+    const __m256d ysf = _mm256_floor_pd(ys);
+    const __m128i xsb = _mm256_cvttpd_epi32(xsf);
+    const __m128i ysb = _mm256_cvttpd_epi32(ysf);
+    const __m256d xsi = _mm256_sub_pd(xs, xsf);
+    const __m256d ysi = _mm256_sub_pd(ys, ysf);
+
+    // Index bits (see above)
+    const __m256d half = _mm256_set1_pd(0.5);
+    const __m256d one = _mm256_set1_pd(1.0);
+    const __m256d zero = _mm256_setzero_pd();
+    const __m256d a = _mm256_and_pd(_mm256_cmp_pd(_mm256_add_pd(xsi, ysi), one, _CMP_GE_OQ), one);
+    const __m256d ha = _mm256_mul_pd(a, half);
+    const __m256d b3 = _mm256_and_pd(_mm256_cmp_pd(_mm256_sub_pd(_mm256_sub_pd(xsi, _mm256_mul_pd(ysi, half)), ha), zero, _CMP_GE_OQ), one);
+    const __m256d b4 = _mm256_and_pd(_mm256_cmp_pd(_mm256_sub_pd(_mm256_sub_pd(ysi, _mm256_mul_pd(xsi, half)), ha), zero, _CMP_GE_OQ), one);
+
+    const __m256d ssi = _mm256_mul_pd(_mm256_add_pd(xsi, ysi), _mm256_set1_pd(-0.211324865405187));
+    const __m256d xi = _mm256_add_pd(xsi, ssi);
+    const __m256d yi = _mm256_add_pd(ysi, ssi);
+
+    const __m256d p2x = _mm256_add_pd(_mm256_sub_pd(_mm256_add_pd(b3, b3), one), a);
+    const __m256d p3y = _mm256_add_pd(_mm256_sub_pd(_mm256_add_pd(b4, b4), one), a);
+    const __m256d xsv[4] { zero, one, p2x, a };
+    const __m256d ysv[4] { zero, one, a, p3y };
+
+    // Point contributions
+    const __m128i pmask = _mm_set1_epi32(PMASK);
+    const auto* grads = storage == Storage::Double ? reinterpret_cast<const double*>(grad2Table()) : nullptr;   // {dx, dy} interleaved
+    const float* gradsf = grads ? nullptr : grad2fTable();
+    __m256d value = zero;
+    for (int i = 0; i < 4; i++) {
+        const __m256d ssv = _mm256_mul_pd(_mm256_add_pd(xsv[i], ysv[i]), _mm256_set1_pd(0.211324865405187));
+        const __m256d dx = _mm256_add_pd(_mm256_sub_pd(xi, xsv[i]), ssv);
+        const __m256d dy = _mm256_add_pd(_mm256_sub_pd(yi, ysv[i]), ssv);
+        __m256d attn = _mm256_sub_pd(_mm256_sub_pd(_mm256_set1_pd(2.0 / 3.0), _mm256_mul_pd(dx, dx)), _mm256_mul_pd(dy, dy));
+        const __m256d live = _mm256_cmp_pd(attn, zero, _CMP_GT_OQ);
+        if (_mm256_movemask_pd(live) == 0) {
+            continue;
+        }
+
+        const __m128i pxm = _mm_and_si128(_mm_add_epi32(xsb, _mm256_cvttpd_epi32(xsv[i])), pmask);
+        const __m128i pym = _mm_and_si128(_mm_add_epi32(ysb, _mm256_cvttpd_epi32(ysv[i])), pmask);
+        const __m128i hash = _mm_xor_si128(_mm_i32gather_epi32(perm, pxm, 4), pym);
+        __m256d gx, gy;
+        if (grads) {
+            const __m128i hash2 = _mm_add_epi32(hash, hash);
+            gx = _mm256_mask_i32gather_pd(zero, grads, hash2, live, 8);
+            gy = _mm256_mask_i32gather_pd(zero, grads + 1, hash2, live, 8);
+        } else {
+            // Every hash is in range, dead lanes are zeroed through attn below
+            gx = _mm256_cvtps_pd(_mm_i32gather_ps(gradsf, hash, 4));
+            gy = _mm256_cvtps_pd(_mm_i32gather_ps(gradsf + PSIZE, hash, 4));
+        }
+        const __m256d extrapolation = _mm256_add_pd(_mm256_mul_pd(gx, dx), _mm256_mul_pd(gy, dy));
+
+        attn = _mm256_and_pd(_mm256_mul_pd(attn, attn), live);
+        value = _mm256_add_pd(value, _mm256_mul_pd(_mm256_mul_pd(attn, attn), extrapolation));
+    }
+    _mm256_storeu_pd(out, value);
+}
+#else
+void OpenSimplex2S::noise2_Batch(const double* x, const double* y, double* out) const {
+    *out = noise2(*x, *y);
+}
+#endif
+
 /**
  * 3D Re-oriented 8-point BCC noise, classic orientation
  * Proper substitute for what 3D SuperSimplex would be,
@@ -166,6 +741,55 @@ double OpenSimplex2S::noise3_XZBeforeY(const double x, const double y, const dou
     return noise3_BCC(xr, yr, zr);
 }
 
+// 3D Re-oriented 8-point BCC noise, classic orientation, with derivatives
+OpenSimplex2S::Sample3 OpenSimplex2S::noise3_Classic_with_gradient(const double x, const double y, const double z) const {
+    const double r = (2.0 / 3.0) * (x + y + z);
+    Sample3 sample = noise3_BCCGradient(r - x, r - y, r - z);
+
+    // The rotation is symmetric, so its transpose is applied the same way
+    const double gr = (2.0 / 3.0) * (sample.dx + sample.dy + sample.dz);
+    sample.dx = gr - sample.dx;
+    sample.dy = gr - sample.dy;
+    sample.dz = gr - sample.dz;
+    return sample;
+}
+
+// 3D Re-oriented 8-point BCC noise, better visual isotropy in (X, Y), with derivatives
+OpenSimplex2S::Sample3 OpenSimplex2S::noise3_XYBeforeZ_with_gradient(const double x, const double y, const double z) const {
+    const double xy = x + y;
+    const double s2 = xy * -0.211324865405187;
+    const double zz = z * 0.577350269189626;
+    Sample3 sample = noise3_BCCGradient(x + s2 - zz, y + s2 - zz, xy * 0.577350269189626 + zz);
+
+    // Transpose of the rotation above
+    const double gxr = sample.dx;
+    const double gyr = sample.dy;
+    const double gzr = sample.dz;
+    const double gs2 = (gxr + gyr) * -0.211324865405187;
+    sample.dx = gxr + gs2 + gzr * 0.577350269189626;
+    sample.dy = gyr + gs2 + gzr * 0.577350269189626;
+    sample.dz = (gzr - gxr - gyr) * 0.577350269189626;
+    return sample;
+}
+
+// 3D Re-oriented 8-point BCC noise, better visual isotropy in (X, Z), with derivatives
+OpenSimplex2S::Sample3 OpenSimplex2S::noise3_XZBeforeY_with_gradient(const double x, const double y, const double z) const {
+    const double xz = x + z;
+    const double s2 = xz * -0.211324865405187;
+    const double yy = y * 0.577350269189626;
+    Sample3 sample = noise3_BCCGradient(x + s2 - yy, xz * 0.577350269189626 + yy, z + s2 - yy);
+
+    // Transpose of the rotation above
+    const double gxr = sample.dx;
+    const double gyr = sample.dy;
+    const double gzr = sample.dz;
+    const double gs2 = (gxr + gzr) * -0.211324865405187;
+    sample.dx = gxr + gs2 + gyr * 0.577350269189626;
+    sample.dy = (gyr - gxr - gzr) * 0.577350269189626;
+    sample.dz = gzr + gs2 + gyr * 0.577350269189626;
+    return sample;
+}
+
 /**
  * Generate overlapping cubic lattices for 3D Re-oriented BCC noise.
  * Lookup table implementation inspired by DigitalShadow.
@@ -188,30 +812,87 @@ double OpenSimplex2S::noise3_BCC(const double xr, const double yr, const double
     const int zht = static_cast<int>(zri + 0.5);
     const int index = (xht << 0) | (yht << 1) | (zht << 2);
 
+    const Grad3* grads = storage == Storage::Double ? grad3Table() : nullptr;
+    const Grad3f* gradsf = grads ? nullptr : grad3fTable();
+
     // Point contributions
     double value = 0;
-    const LatticePoint3D* c = &LOOKUP_3D[index];
-    while (c != nullptr) {
+    const auto& points = LOOKUP_3D[index];
+    for (const LatticePoint3D* c = &points[0]; c != nullptr;) {
         const double dxr = xri + c->dxr;
         const double dyr = yri + c->dyr;
         const double dzr = zri + c->dzr;
         if (double attn = 0.75 - dxr * dxr - dyr * dyr - dzr * dzr; attn < 0) {
-            c = c->nextOnFailure;
+            c = c->nextOnFailure == LatticePoint3D::END ? nullptr : &points[c->nextOnFailure];
         } else {
             const int pxm = (xrb + c->xrv) & PMASK;
             const int pym = (yrb + c->yrv) & PMASK;
             const int pzm = (zrb + c->zrv) & PMASK;
-            Grad3 grad = permGrad3[perm[perm[pxm] ^ pym] ^ pzm];
-            const double extrapolation = grad.dx * dxr + grad.dy * dyr + grad.dz * dzr;
+            const int gi = perm[perm[pxm] ^ pym] ^ pzm;
+            const double extrapolation = grads ? grads[gi].dx * dxr + grads[gi].dy * dyr + grads[gi].dz * dzr
+                                               : gradsf[gi].dx * dxr + gradsf[gi].dy * dyr + gradsf[gi].dz * dzr;
 
             attn *= attn;
             value += attn * attn * extrapolation;
-            c = c->nextOnSuccess;
+            c = c->nextOnSuccess == LatticePoint3D::END ? nullptr : &points[c->nextOnSuccess];
         }
     }
     return value;
 }
 
+/**
+ * noise3_BCC with derivatives, see noise2_BaseGradient (here attn = 0.75 - |d|^2).
+ */
+OpenSimplex2S::Sample3 OpenSimplex2S::noise3_BCCGradient(const double xr, const double yr, const double zr) const {
+    // Get base and offsets inside cube of first lattice.
+    const int xrb = fastFloor(xr);
+    const int yrb = fastFloor(yr);
+    const int zrb = fastFloor(zr);
+    const double xri = xr - xrb;
+    const double yri = yr - yrb;
+    const double zri = zr - zrb;
+
+    // Identify which octant of the cube we're in.
+    const int xht = static_cast<int>(xri + 0.5);
+    const int yht = static_cast<int>(yri + 0.5);
+    const int zht = static_cast<int>(zri + 0.5);
+    const int index = (xht << 0) | (yht << 1) | (zht << 2);
+
+    const Grad3* grads = storage == Storage::Double ? grad3Table() : nullptr;
+    const Grad3f* gradsf = grads ? nullptr : grad3fTable();
+
+    // Point contributions
+    Sample3 sample;
+    const auto& points = LOOKUP_3D[index];
+    for (const LatticePoint3D* c = &points[0]; c != nullptr;) {
+        const double dxr = xri + c->dxr;
+        const double dyr = yri + c->dyr;
+        const double dzr = zri + c->dzr;
+        if (const double attn = 0.75 - dxr * dxr - dyr * dyr - dzr * dzr; attn < 0) {
+            c = c->nextOnFailure == LatticePoint3D::END ? nullptr : &points[c->nextOnFailure];
+        } else {
+            const int pxm = (xrb + c->xrv) & PMASK;
+            const int pym = (yrb + c->yrv) & PMASK;
+            const int pzm = (zrb + c->zrv) & PMASK;
+            const int gi = perm[perm[pxm] ^ pym] ^ pzm;
+            const double gx = grads ? grads[gi].dx : gradsf[gi].dx;
+            const double gy = grads ? grads[gi].dy : gradsf[gi].dy;
+            const double gz = grads ? grads[gi].dz : gradsf[gi].dz;
+            const double extrapolation = gx * dxr + gy * dyr + gz * dzr;
+
+            const double attn2 = attn * attn;
+            const double attn4 = attn2 * attn2;
+            const double falloff = -8 * attn2 * attn * extrapolation;
+            sample.value += attn4 * extrapolation;
+            sample.dx += attn4 * gx + falloff * dxr;
+            sample.dy += attn4 * gy + falloff * dyr;
+            sample.dz += attn4 * gz + falloff * dzr;
+            c = c->nextOnSuccess == LatticePoint3D::END ? nullptr : &points[c->nextOnSuccess];
+        }
+    }
+    return sample;
+}
+
 /**
  * 4D SuperSimplex noise, classic lattice orientation.
  */
@@ -302,6 +983,9 @@ double OpenSimplex2S::noise4_Base(const double xs, const double ys, const double
 
     const int index = (fastFloor(xs * 4) & 3) << 0 | (fastFloor(ys * 4) & 3) << 2 | (fastFloor(zs * 4) & 3) << 4 | (fastFloor(ws * 4) & 3) << 6;
 
+    const Grad4* grads = storage == Storage::Double ? grad4Table() : nullptr;
+    const Grad4f* gradsf = grads ? nullptr : grad4fTable();
+
     // Point contributions
     for (int i = 0; i < LOOKUP_4D_SIZE[index]; ++i) {
         const LatticePoint4D& c = LOOKUP_4D[index][i];
@@ -317,8 +1001,9 @@ double OpenSimplex2S::noise4_Base(const double xs, const double ys, const double
             const int pym = (ysb + c.ysv) & PMASK;
             const int pzm = (zsb + c.zsv) & PMASK;
             const int pwm = (wsb + c.wsv) & PMASK;
-            Grad4 grad = permGrad4[perm[perm[perm[pxm] ^ pym] ^ pzm] ^ pwm];
-            const double extrapolation = grad.dx * dx + grad.dy * dy + grad.dz * dz + grad.dw * dw;
+            const int gi = perm[perm[perm[pxm] ^ pym] ^ pzm] ^ pwm;
+            const double extrapolation = grads ? grads[gi].dx * dx + grads[gi].dy * dy + grads[gi].dz * dz + grads[gi].dw * dw
+                                               : gradsf[gi].dx * dx + gradsf[gi].dy * dy + gradsf[gi].dz * dz + gradsf[gi].dw * dw;
 
             value += attn * attn * extrapolation;
         }
@@ -330,43 +1015,10 @@ int OpenSimplex2S::fastFloor(double x) {
     const int xi = static_cast<int>(x);
     return x < xi ? xi - 1 : xi;
 }
+// Lattice point lookup tables, generated at compile time into read-only data
 
-OpenSimplex2S::LatticePoint2D::LatticePoint2D(int a_xsv, int a_ysv) {
-    xsv = a_xsv;
-    ysv = a_ysv;
-    const double ssv = (a_xsv + a_ysv) * -0.211324865405187;
-    dx = -a_xsv - ssv;
-    dy = -a_ysv - ssv;
-}
-
-OpenSimplex2S::LatticePoint2D::LatticePoint2D() = default;
-
-OpenSimplex2S::LatticePoint3D::LatticePoint3D(int a_xrv, int a_yrv, int a_zrv, int lattice) {
-    dxr = -a_xrv + lattice * 0.5;
-    dyr = -a_yrv + lattice * 0.5;
-    dzr = -a_zrv + lattice * 0.5;
-    xrv = a_xrv + lattice * 1024;
-    yrv = a_yrv + lattice * 1024;
-    zrv = a_zrv + lattice * 1024;
-}
-
-OpenSimplex2S::LatticePoint3D::LatticePoint3D() = default;
-
-OpenSimplex2S::LatticePoint4D::LatticePoint4D(int a_xsv, int a_ysv, int a_zsv, int a_wsv) {
-    xsv = a_xsv;
-    ysv = a_ysv;
-    zsv = a_zsv;
-    wsv = a_wsv;
-    const double ssv = (a_xsv + a_ysv + a_zsv + a_wsv) * -0.138196601125011;
-    dx = -a_xsv - ssv;
-    dy = -a_ysv - ssv;
-    dz = -a_zsv - ssv;
-    dw = -a_wsv - ssv;
-}
-
-OpenSimplex2S::LatticePoint4D::LatticePoint4D() = default;
-
-void OpenSimplex2S::initLatticePoints() {
+constexpr std::array<OpenSimplex2S::LatticePoint2D, 8 * 4> OpenSimplex2S::LOOKUP_2D = [] {
+    std::array<LatticePoint2D, 8 * 4> lookup {};
     for (int i = 0; i < 8; i++) {
         int i1, j1, i2, j2;
         if ((i & 1) == 0) {
@@ -400,12 +1052,16 @@ void OpenSimplex2S::initLatticePoints() {
                 j2 = 0;
             }
         }
-        LOOKUP_2D[i * 4 + 0] = { 0, 0 };
-        LOOKUP_2D[i * 4 + 1] = { 1, 1 };
-        LOOKUP_2D[i * 4 + 2] = { i1, j1 };
-        LOOKUP_2D[i * 4 + 3] = { i2, j2 };
+        lookup[i * 4 + 0] = { 0, 0 };
+        lookup[i * 4 + 1] = { 1, 1 };
+        lookup[i * 4 + 2] = { i1, j1 };
+        lookup[i * 4 + 3] = { i2, j2 };
     }
+    return lookup;
+}();
 
+constexpr std::array<std::array<OpenSimplex2S::LatticePoint3D, 14>, 8> OpenSimplex2S::LOOKUP_3D = [] {
+    std::array<std::array<LatticePoint3D, 14>, 8> lookup {};
     for (int i = 0; i < 8; i++) {
         const int i1 = i >> 0 & 1;
         const int j1 = i >> 1 & 1;
@@ -414,378 +1070,383 @@ void OpenSimplex2S::initLatticePoints() {
         const int j2 = j1 ^ 1;
         const int k2 = k1 ^ 1;
 
-        auto& head = LOOKUP_3D[i];
-        head = LatticePoint3D(i1, j1, k1, 0);
-
-        auto& P = LOOKUP_3D_EXTRA[i];
+        auto& c = lookup[i];
 
         // The two points within this octant, one from each of the two cubic half-lattices
-        auto* c0 = &head;
-        auto* c1 = &P[0]; *c1 = LatticePoint3D(i1 + i2, j1 + j2, k1 + k2, 1);
+        c[0x0] = { i1, j1, k1, 0 };
+        c[0x1] = { i1 + i2, j1 + j2, k1 + k2, 1 };
 
         // (1, 0, 0) vs (0, 1, 1) away from octant
-        auto* c2 = &P[1]; *c2 = LatticePoint3D(i1 ^ 1, j1, k1, 0);
-        auto* c3 = &P[2]; *c3 = LatticePoint3D(i1, j1 ^ 1, k1 ^ 1, 0);
+        c[0x2] = { i1 ^ 1, j1, k1, 0 };
+        c[0x3] = { i1, j1 ^ 1, k1 ^ 1, 0 };
 
         // (1, 0, 0) vs (0, 1, 1) away from octant, on second half-lattice.
-        auto* c4 = &P[3]; *c4 = LatticePoint3D(i1 + (i2 ^ 1), j1 + j2, k1 + k2, 1);
-        auto* c5 = &P[4]; *c5 = LatticePoint3D(i1 + i2, j1 + (j2 ^ 1), k1 + (k2 ^ 1), 1);
+        c[0x4] = { i1 + (i2 ^ 1), j1 + j2, k1 + k2, 1 };
+        c[0x5] = { i1 + i2, j1 + (j2 ^ 1), k1 + (k2 ^ 1), 1 };
 
         // (0, 1, 0) vs (1, 0, 1) away from octant
-        auto* c6 = &P[5]; *c6 = LatticePoint3D(i1, j1 ^ 1, k1, 0);
-        auto* c7 = &P[6]; *c7 = LatticePoint3D(i1 ^ 1, j1, k1 ^ 1, 0);
+        c[0x6] = { i1, j1 ^ 1, k1, 0 };
+        c[0x7] = { i1 ^ 1, j1, k1 ^ 1, 0 };
 
         // (0, 1, 0) vs (1, 0, 1) away from octant, on second half-lattice
-        auto* c8 = &P[7]; *c8 = LatticePoint3D(i1 + i2, j1 + (j2 ^ 1), k1 + k2, 1);
-        auto* c9 = &P[8]; *c9 = LatticePoint3D(i1 + (i2 ^ 1), j1 + j2, k1 + (k2 ^ 1), 1);
+        c[0x8] = { i1 + i2, j1 + (j2 ^ 1), k1 + k2, 1 };
+        c[0x9] = { i1 + (i2 ^ 1), j1 + j2, k1 + (k2 ^ 1), 1 };
 
         // (0, 0, 1) vs (1, 1, 0) away from octant
-        auto* cA = &P[9]; *cA = LatticePoint3D(i1, j1, k1 ^ 1, 0);
-        auto* cB = &P[10]; *cB = LatticePoint3D(i1 ^ 1, j1 ^ 1, k1, 0);
+        c[0xA] = { i1, j1, k1 ^ 1, 0 };
+        c[0xB] = { i1 ^ 1, j1 ^ 1, k1, 0 };
 
         // (0, 0, 1) vs (1, 1, 0) away from octant, on second half-lattice
-        auto* cC = &P[11]; *cC = LatticePoint3D(i1 + i2, j1 + j2, k1 + (k2 ^ 1), 1);
-        auto* cD = &P[12]; *cD = LatticePoint3D(i1 + (i2 ^ 1), j1 + (j2 ^ 1), k1 + k2, 1);
+        c[0xC] = { i1 + i2, j1 + j2, k1 + (k2 ^ 1), 1 };
+        c[0xD] = { i1 + (i2 ^ 1), j1 + (j2 ^ 1), k1 + k2, 1 };
 
         // First two points are guaranteed
-        c0->nextOnFailure = c0->nextOnSuccess = c1;
-        c1->nextOnFailure = c1->nextOnSuccess = c2;
+        c[0x0].nextOnFailure = c[0x0].nextOnSuccess = 0x1;
+        c[0x1].nextOnFailure = c[0x1].nextOnSuccess = 0x2;
 
         // If c2 is in range, then we know c3 and c4 are not
-        c2->nextOnFailure = c3;
-        c2->nextOnSuccess = c5;
-        c3->nextOnFailure = c4;
-        c3->nextOnSuccess = c4;
+        c[0x2].nextOnFailure = 0x3;
+        c[0x2].nextOnSuccess = 0x5;
+        c[0x3].nextOnFailure = 0x4;
+        c[0x3].nextOnSuccess = 0x4;
 
         // If c4 is in range, then we know c5 is not
-        c4->nextOnFailure = c5;
-        c4->nextOnSuccess = c6;
-        c5->nextOnFailure = c5->nextOnSuccess = c6;
+        c[0x4].nextOnFailure = 0x5;
+        c[0x4].nextOnSuccess = 0x6;
+        c[0x5].nextOnFailure = c[0x5].nextOnSuccess = 0x6;
 
         // If c6 is in range, then we know c7 and c8 are not
-        c6->nextOnFailure = c7;
-        c6->nextOnSuccess = c9;
-        c7->nextOnFailure = c8;
-        c7->nextOnSuccess = c8;
+        c[0x6].nextOnFailure = 0x7;
+        c[0x6].nextOnSuccess = 0x9;
+        c[0x7].nextOnFailure = 0x8;
+        c[0x7].nextOnSuccess = 0x8;
 
         // If c8 is in range, then we know c9 is not
-        c8->nextOnFailure = c9;
-        c8->nextOnSuccess = cA;
-        c9->nextOnFailure = c9->nextOnSuccess = cA;
+        c[0x8].nextOnFailure = 0x9;
+        c[0x8].nextOnSuccess = 0xA;
+        c[0x9].nextOnFailure = c[0x9].nextOnSuccess = 0xA;
 
         // If cA is in range, then we know cB and cC are not
-        cA->nextOnFailure = cB;
-        cA->nextOnSuccess = cD;
-        cB->nextOnFailure = cC;
-        cB->nextOnSuccess = cC;
+        c[0xA].nextOnFailure = 0xB;
+        c[0xA].nextOnSuccess = 0xD;
+        c[0xB].nextOnFailure = 0xC;
+        c[0xB].nextOnSuccess = 0xC;
 
         // If cC is in range, then we know cD is not
-        cC->nextOnFailure = cD;
-        cC->nextOnSuccess = nullptr;
-        cD->nextOnFailure = cD->nextOnSuccess = nullptr;
-
-        LOOKUP_3D[i] = *c0;
+        c[0xC].nextOnFailure = 0xD;
+        c[0xC].nextOnSuccess = LatticePoint3D::END;
+        c[0xD].nextOnFailure = c[0xD].nextOnSuccess = LatticePoint3D::END;
     }
+    return lookup;
+}();
+
+constexpr std::array<unsigned char, 256> OpenSimplex2S::LOOKUP_4D_SIZE {
+    // clang-format off
+    20, 15, 16, 17, 15, 16, 12, 15, 16, 12, 10, 14, 17, 15, 14, 17,
+    15, 16, 12, 15, 16, 14, 14, 13, 12, 14, 11, 12, 15, 13, 12, 14,
+    16, 12, 10, 14, 12, 14, 11, 12, 10, 11, 10, 13, 14, 12, 13, 15,
+    17, 15, 14, 17, 15, 13, 12, 14, 14, 12, 13, 15, 17, 14, 15, 17,
+    15, 16, 12, 15, 16, 14, 14, 13, 12, 14, 11, 12, 15, 13, 12, 14,
+    16, 14, 14, 13, 14, 16, 16, 10, 14, 16, 19, 11, 13, 10, 11, 10,
+    12, 14, 11, 12, 14, 16, 19, 11, 11, 19, 13, 14, 12, 11, 14, 13,
+    15, 13, 12, 14, 13, 10, 11, 10, 12, 11, 14, 13, 14, 10, 13, 13,
+    16, 12, 10, 14, 12, 14, 11, 12, 10, 11, 10, 13, 14, 12, 13, 15,
+    12, 14, 11, 12, 14, 16, 19, 11, 11, 19, 13, 14, 12, 11, 14, 13,
+    10, 11, 10, 13, 11, 19, 13, 14, 10, 13, 16, 14, 13, 14, 14, 16,
+    14, 12, 13, 15, 12, 11, 14, 13, 13, 14, 14, 16, 15, 13, 16, 15,
+    17, 15, 14, 17, 15, 13, 12, 14, 14, 12, 13, 15, 17, 14, 15, 17,
+    15, 13, 12, 14, 13, 10, 11, 10, 12, 11, 14, 13, 14, 10, 13, 13,
+    14, 12, 13, 15, 12, 11, 14, 13, 13, 14, 14, 16, 15, 13, 16, 15,
+    17, 14, 15, 17, 14, 10, 13, 13, 15, 13, 16, 15, 17, 13, 15, 20,
+    // clang-format on
+};
+
+namespace {
+    // Indices into the 256 4x4x4x4 lattice points, LOOKUP_4D_SIZE[i] of them are used for cell i
+    constexpr unsigned char LOOKUP_4D_PREGEN[256][20] {
+        // clang-format off
+        { 0x15, 0x45, 0x51, 0x54, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA },
+        { 0x15, 0x45, 0x51, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x6A, 0x95, 0x96, 0x9A, 0xA6, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x01, 0x05, 0x11, 0x15, 0x41, 0x45, 0x51, 0x55, 0x56, 0x5A, 0x66, 0x6A, 0x96, 0x9A, 0xA6, 0xAA, 0x00, 0x00, 0x00, 0x00 },
+        { 0x01, 0x15, 0x16, 0x45, 0x46, 0x51, 0x52, 0x55, 0x56, 0x5A, 0x66, 0x6A, 0x96, 0x9A, 0xA6, 0xAA, 0xAB, 0x00, 0x00, 0x00 },
+        { 0x15, 0x45, 0x54, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x69, 0x6A, 0x95, 0x99, 0x9A, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x05, 0x15, 0x45, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0x95, 0x96, 0x99, 0x9A, 0xAA, 0x00, 0x00, 0x00, 0x00 },
+        { 0x05, 0x15, 0x45, 0x55, 0x56, 0x59, 0x5A, 0x66, 0x6A, 0x96, 0x9A, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x05, 0x15, 0x16, 0x45, 0x46, 0x55, 0x56, 0x59, 0x5A, 0x66, 0x6A, 0x96, 0x9A, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x04, 0x05, 0x14, 0x15, 0x44, 0x45, 0x54, 0x55, 0x59, 0x5A, 0x69, 0x6A, 0x99, 0x9A, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00 },
+        { 0x05, 0x15, 0x45, 0x55, 0x56, 0x59, 0x5A, 0x69, 0x6A, 0x99, 0x9A, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x05, 0x15, 0x45, 0x55, 0x56, 0x59, 0x5A, 0x6A, 0x9A, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x05, 0x15, 0x16, 0x45, 0x46, 0x55, 0x56, 0x59, 0x5A, 0x5B, 0x6A, 0x9A, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x04, 0x15, 0x19, 0x45, 0x49, 0x54, 0x55, 0x58, 0x59, 0x5A, 0x69, 0x6A, 0x99, 0x9A, 0xA9, 0xAA, 0xAE, 0x00, 0x00, 0x00 },
+        { 0x05, 0x15, 0x19, 0x45, 0x49, 0x55, 0x56, 0x59, 0x5A, 0x69, 0x6A, 0x99, 0x9A, 0xAA, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x05, 0x15, 0x19, 0x45, 0x49, 0x55, 0x56, 0x59, 0x5A, 0x5E, 0x6A, 0x9A, 0xAA, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x05, 0x15, 0x1A, 0x45, 0x4A, 0x55, 0x56, 0x59, 0x5A, 0x5B, 0x5E, 0x6A, 0x9A, 0xAA, 0xAB, 0xAE, 0xAF, 0x00, 0x00, 0x00 },
+        { 0x15, 0x51, 0x54, 0x55, 0x56, 0x59, 0x65, 0x66, 0x69, 0x6A, 0x95, 0xA5, 0xA6, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x11, 0x15, 0x51, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0x95, 0x96, 0xA5, 0xA6, 0xAA, 0x00, 0x00, 0x00, 0x00 },
+        { 0x11, 0x15, 0x51, 0x55, 0x56, 0x5A, 0x65, 0x66, 0x6A, 0x96, 0xA6, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x11, 0x15, 0x16, 0x51, 0x52, 0x55, 0x56, 0x5A, 0x65, 0x66, 0x6A, 0x96, 0xA6, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x14, 0x15, 0x54, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0x95, 0x99, 0xA5, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00 },
+        { 0x15, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0x95, 0x9A, 0xA6, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x15, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0x96, 0x9A, 0xA6, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x15, 0x16, 0x55, 0x56, 0x5A, 0x66, 0x6A, 0x6B, 0x96, 0x9A, 0xA6, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x14, 0x15, 0x54, 0x55, 0x59, 0x5A, 0x65, 0x69, 0x6A, 0x99, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x15, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0x99, 0x9A, 0xA9, 0xAA, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x15, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0x9A, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x15, 0x16, 0x55, 0x56, 0x59, 0x5A, 0x66, 0x6A, 0x6B, 0x9A, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x14, 0x15, 0x19, 0x54, 0x55, 0x58, 0x59, 0x5A, 0x65, 0x69, 0x6A, 0x99, 0xA9, 0xAA, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x15, 0x19, 0x55, 0x59, 0x5A, 0x69, 0x6A, 0x6E, 0x99, 0x9A, 0xA9, 0xAA, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x15, 0x19, 0x55, 0x56, 0x59, 0x5A, 0x69, 0x6A, 0x6E, 0x9A, 0xAA, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x15, 0x1A, 0x55, 0x56, 0x59, 0x5A, 0x6A, 0x6B, 0x6E, 0x9A, 0xAA, 0xAB, 0xAE, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x10, 0x11, 0x14, 0x15, 0x50, 0x51, 0x54, 0x55, 0x65, 0x66, 0x69, 0x6A, 0xA5, 0xA6, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00 },
+        { 0x11, 0x15, 0x51, 0x55, 0x56, 0x65, 0x66, 0x69, 0x6A, 0xA5, 0xA6, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x11, 0x15, 0x51, 0x55, 0x56, 0x65, 0x66, 0x6A, 0xA6, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x11, 0x15, 0x16, 0x51, 0x52, 0x55, 0x56, 0x65, 0x66, 0x67, 0x6A, 0xA6, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x14, 0x15, 0x54, 0x55, 0x59, 0x65, 0x66, 0x69, 0x6A, 0xA5, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x15, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0xA5, 0xA6, 0xA9, 0xAA, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x15, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0xA6, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x15, 0x16, 0x55, 0x56, 0x5A, 0x65, 0x66, 0x6A, 0x6B, 0xA6, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x14, 0x15, 0x54, 0x55, 0x59, 0x65, 0x69, 0x6A, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x15, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x15, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x15, 0x16, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0x6B, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x14, 0x15, 0x19, 0x54, 0x55, 0x58, 0x59, 0x65, 0x69, 0x6A, 0x6D, 0xA9, 0xAA, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x15, 0x19, 0x55, 0x59, 0x5A, 0x65, 0x69, 0x6A, 0x6E, 0xA9, 0xAA, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x15, 0x19, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0x6E, 0xAA, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x15, 0x55, 0x56, 0x59, 0x5A, 0x66, 0x69, 0x6A, 0x6B, 0x6E, 0x9A, 0xAA, 0xAB, 0xAE, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x10, 0x15, 0x25, 0x51, 0x54, 0x55, 0x61, 0x64, 0x65, 0x66, 0x69, 0x6A, 0xA5, 0xA6, 0xA9, 0xAA, 0xBA, 0x00, 0x00, 0x00 },
+        { 0x11, 0x15, 0x25, 0x51, 0x55, 0x56, 0x61, 0x65, 0x66, 0x69, 0x6A, 0xA5, 0xA6, 0xAA, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x11, 0x15, 0x25, 0x51, 0x55, 0x56, 0x61, 0x65, 0x66, 0x6A, 0x76, 0xA6, 0xAA, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x11, 0x15, 0x26, 0x51, 0x55, 0x56, 0x62, 0x65, 0x66, 0x67, 0x6A, 0x76, 0xA6, 0xAA, 0xAB, 0xBA, 0xBB, 0x00, 0x00, 0x00 },
+        { 0x14, 0x15, 0x25, 0x54, 0x55, 0x59, 0x64, 0x65, 0x66, 0x69, 0x6A, 0xA5, 0xA9, 0xAA, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x15, 0x25, 0x55, 0x65, 0x66, 0x69, 0x6A, 0x7A, 0xA5, 0xA6, 0xA9, 0xAA, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x15, 0x25, 0x55, 0x56, 0x65, 0x66, 0x69, 0x6A, 0x7A, 0xA6, 0xAA, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x15, 0x26, 0x55, 0x56, 0x65, 0x66, 0x6A, 0x6B, 0x7A, 0xA6, 0xAA, 0xAB, 0xBA, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x14, 0x15, 0x25, 0x54, 0x55, 0x59, 0x64, 0x65, 0x69, 0x6A, 0x79, 0xA9, 0xAA, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x15, 0x25, 0x55, 0x59, 0x65, 0x66, 0x69, 0x6A, 0x7A, 0xA9, 0xAA, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x15, 0x25, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0x7A, 0xAA, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x15, 0x55, 0x56, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0x6B, 0x7A, 0xA6, 0xAA, 0xAB, 0xBA, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x14, 0x15, 0x29, 0x54, 0x55, 0x59, 0x65, 0x68, 0x69, 0x6A, 0x6D, 0x79, 0xA9, 0xAA, 0xAE, 0xBA, 0xBE, 0x00, 0x00, 0x00 },
+        { 0x15, 0x29, 0x55, 0x59, 0x65, 0x69, 0x6A, 0x6E, 0x7A, 0xA9, 0xAA, 0xAE, 0xBA, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x15, 0x55, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0x6E, 0x7A, 0xA9, 0xAA, 0xAE, 0xBA, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x15, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0x6B, 0x6E, 0x7A, 0xAA, 0xAB, 0xAE, 0xBA, 0xBF, 0x00, 0x00, 0x00 },
+        { 0x45, 0x51, 0x54, 0x55, 0x56, 0x59, 0x65, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x41, 0x45, 0x51, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xAA, 0x00, 0x00, 0x00, 0x00 },
+        { 0x41, 0x45, 0x51, 0x55, 0x56, 0x5A, 0x66, 0x95, 0x96, 0x9A, 0xA6, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x41, 0x45, 0x46, 0x51, 0x52, 0x55, 0x56, 0x5A, 0x66, 0x95, 0x96, 0x9A, 0xA6, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x44, 0x45, 0x54, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x69, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00 },
+        { 0x45, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x6A, 0x95, 0x96, 0x99, 0x9A, 0xA6, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x45, 0x55, 0x56, 0x59, 0x5A, 0x66, 0x6A, 0x95, 0x96, 0x99, 0x9A, 0xA6, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x45, 0x46, 0x55, 0x56, 0x5A, 0x66, 0x6A, 0x96, 0x9A, 0x9B, 0xA6, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x44, 0x45, 0x54, 0x55, 0x59, 0x5A, 0x69, 0x95, 0x99, 0x9A, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x45, 0x55, 0x56, 0x59, 0x5A, 0x69, 0x6A, 0x95, 0x96, 0x99, 0x9A, 0xA9, 0xAA, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x45, 0x55, 0x56, 0x59, 0x5A, 0x6A, 0x95, 0x96, 0x99, 0x9A, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x45, 0x46, 0x55, 0x56, 0x59, 0x5A, 0x6A, 0x96, 0x9A, 0x9B, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x44, 0x45, 0x49, 0x54, 0x55, 0x58, 0x59, 0x5A, 0x69, 0x95, 0x99, 0x9A, 0xA9, 0xAA, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x45, 0x49, 0x55, 0x59, 0x5A, 0x69, 0x6A, 0x99, 0x9A, 0x9E, 0xA9, 0xAA, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x45, 0x49, 0x55, 0x56, 0x59, 0x5A, 0x6A, 0x99, 0x9A, 0x9E, 0xAA, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x45, 0x4A, 0x55, 0x56, 0x59, 0x5A, 0x6A, 0x9A, 0x9B, 0x9E, 0xAA, 0xAB, 0xAE, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x50, 0x51, 0x54, 0x55, 0x56, 0x59, 0x65, 0x66, 0x69, 0x95, 0x96, 0x99, 0xA5, 0xA6, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00 },
+        { 0x51, 0x55, 0x56, 0x59, 0x65, 0x66, 0x6A, 0x95, 0x96, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x51, 0x55, 0x56, 0x5A, 0x65, 0x66, 0x6A, 0x95, 0x96, 0x9A, 0xA5, 0xA6, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x51, 0x52, 0x55, 0x56, 0x5A, 0x66, 0x6A, 0x96, 0x9A, 0xA6, 0xA7, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x54, 0x55, 0x56, 0x59, 0x65, 0x69, 0x6A, 0x95, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00 },
+        { 0x15, 0x45, 0x51, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x6A, 0x95, 0x96, 0x9A, 0xA6, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00 },
+        { 0x55, 0x56, 0x5A, 0x66, 0x6A, 0x96, 0x9A, 0xA6, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x54, 0x55, 0x59, 0x5A, 0x65, 0x69, 0x6A, 0x95, 0x99, 0x9A, 0xA5, 0xA9, 0xAA, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x15, 0x45, 0x54, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x69, 0x6A, 0x95, 0x99, 0x9A, 0xA9, 0xAA, 0xAE, 0x00, 0x00, 0x00, 0x00 },
+        { 0x15, 0x45, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0x95, 0x96, 0x99, 0x9A, 0xA6, 0xA9, 0xAA, 0xAB, 0xAE, 0x00 },
+        { 0x55, 0x56, 0x59, 0x5A, 0x66, 0x6A, 0x96, 0x9A, 0xA6, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x54, 0x55, 0x58, 0x59, 0x5A, 0x69, 0x6A, 0x99, 0x9A, 0xA9, 0xAA, 0xAD, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x55, 0x59, 0x5A, 0x69, 0x6A, 0x99, 0x9A, 0xA9, 0xAA, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x55, 0x56, 0x59, 0x5A, 0x69, 0x6A, 0x99, 0x9A, 0xA9, 0xAA, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x55, 0x56, 0x59, 0x5A, 0x6A, 0x9A, 0xAA, 0xAB, 0xAE, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x50, 0x51, 0x54, 0x55, 0x65, 0x66, 0x69, 0x95, 0xA5, 0xA6, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x51, 0x55, 0x56, 0x65, 0x66, 0x69, 0x6A, 0x95, 0x96, 0xA5, 0xA6, 0xA9, 0xAA, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x51, 0x55, 0x56, 0x65, 0x66, 0x6A, 0x95, 0x96, 0xA5, 0xA6, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x51, 0x52, 0x55, 0x56, 0x65, 0x66, 0x6A, 0x96, 0xA6, 0xA7, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x54, 0x55, 0x59, 0x65, 0x66, 0x69, 0x6A, 0x95, 0x99, 0xA5, 0xA6, 0xA9, 0xAA, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x15, 0x51, 0x54, 0x55, 0x56, 0x59, 0x65, 0x66, 0x69, 0x6A, 0x95, 0xA5, 0xA6, 0xA9, 0xAA, 0xBA, 0x00, 0x00, 0x00, 0x00 },
+        { 0x15, 0x51, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0x95, 0x96, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xAB, 0xBA, 0x00 },
+        { 0x55, 0x56, 0x5A, 0x65, 0x66, 0x6A, 0x96, 0x9A, 0xA6, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x54, 0x55, 0x59, 0x65, 0x69, 0x6A, 0x95, 0x99, 0xA5, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x15, 0x54, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0x95, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xAE, 0xBA, 0x00 },
+        { 0x15, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0x9A, 0xA6, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x15, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0x96, 0x9A, 0xA6, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x54, 0x55, 0x58, 0x59, 0x65, 0x69, 0x6A, 0x99, 0xA9, 0xAA, 0xAD, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x55, 0x59, 0x5A, 0x65, 0x69, 0x6A, 0x99, 0x9A, 0xA9, 0xAA, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x15, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0x99, 0x9A, 0xA9, 0xAA, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x15, 0x55, 0x56, 0x59, 0x5A, 0x66, 0x69, 0x6A, 0x9A, 0xAA, 0xAB, 0xAE, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x50, 0x51, 0x54, 0x55, 0x61, 0x64, 0x65, 0x66, 0x69, 0x95, 0xA5, 0xA6, 0xA9, 0xAA, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x51, 0x55, 0x61, 0x65, 0x66, 0x69, 0x6A, 0xA5, 0xA6, 0xA9, 0xAA, 0xB6, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x51, 0x55, 0x56, 0x61, 0x65, 0x66, 0x6A, 0xA5, 0xA6, 0xAA, 0xB6, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x51, 0x55, 0x56, 0x62, 0x65, 0x66, 0x6A, 0xA6, 0xA7, 0xAA, 0xAB, 0xB6, 0xBA, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x54, 0x55, 0x64, 0x65, 0x66, 0x69, 0x6A, 0xA5, 0xA6, 0xA9, 0xAA, 0xB9, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x55, 0x65, 0x66, 0x69, 0x6A, 0xA5, 0xA6, 0xA9, 0xAA, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x55, 0x56, 0x65, 0x66, 0x69, 0x6A, 0xA5, 0xA6, 0xA9, 0xAA, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x55, 0x56, 0x65, 0x66, 0x6A, 0xA6, 0xAA, 0xAB, 0xBA, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x54, 0x55, 0x59, 0x64, 0x65, 0x69, 0x6A, 0xA5, 0xA9, 0xAA, 0xB9, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x55, 0x59, 0x65, 0x66, 0x69, 0x6A, 0xA5, 0xA6, 0xA9, 0xAA, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x15, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0xA5, 0xA6, 0xA9, 0xAA, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x15, 0x55, 0x56, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0xA6, 0xAA, 0xAB, 0xBA, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x54, 0x55, 0x59, 0x65, 0x68, 0x69, 0x6A, 0xA9, 0xAA, 0xAD, 0xAE, 0xB9, 0xBA, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x55, 0x59, 0x65, 0x69, 0x6A, 0xA9, 0xAA, 0xAE, 0xBA, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x15, 0x55, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0xA9, 0xAA, 0xAE, 0xBA, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0xAA, 0xAB, 0xAE, 0xBA, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x40, 0x41, 0x44, 0x45, 0x50, 0x51, 0x54, 0x55, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00 },
+        { 0x41, 0x45, 0x51, 0x55, 0x56, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x41, 0x45, 0x51, 0x55, 0x56, 0x95, 0x96, 0x9A, 0xA6, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x41, 0x45, 0x46, 0x51, 0x52, 0x55, 0x56, 0x95, 0x96, 0x97, 0x9A, 0xA6, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x44, 0x45, 0x54, 0x55, 0x59, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x45, 0x55, 0x56, 0x59, 0x5A, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x45, 0x55, 0x56, 0x59, 0x5A, 0x95, 0x96, 0x99, 0x9A, 0xA6, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x45, 0x46, 0x55, 0x56, 0x5A, 0x95, 0x96, 0x9A, 0x9B, 0xA6, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x44, 0x45, 0x54, 0x55, 0x59, 0x95, 0x99, 0x9A, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x45, 0x55, 0x56, 0x59, 0x5A, 0x95, 0x96, 0x99, 0x9A, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x45, 0x55, 0x56, 0x59, 0x5A, 0x95, 0x96, 0x99, 0x9A, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x45, 0x46, 0x55, 0x56, 0x59, 0x5A, 0x95, 0x96, 0x99, 0x9A, 0x9B, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x44, 0x45, 0x49, 0x54, 0x55, 0x58, 0x59, 0x95, 0x99, 0x9A, 0x9D, 0xA9, 0xAA, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x45, 0x49, 0x55, 0x59, 0x5A, 0x95, 0x99, 0x9A, 0x9E, 0xA9, 0xAA, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x45, 0x49, 0x55, 0x56, 0x59, 0x5A, 0x95, 0x96, 0x99, 0x9A, 0x9E, 0xAA, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x45, 0x55, 0x56, 0x59, 0x5A, 0x6A, 0x96, 0x99, 0x9A, 0x9B, 0x9E, 0xAA, 0xAB, 0xAE, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x50, 0x51, 0x54, 0x55, 0x65, 0x95, 0x96, 0x99, 0xA5, 0xA6, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x51, 0x55, 0x56, 0x65, 0x66, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x51, 0x55, 0x56, 0x65, 0x66, 0x95, 0x96, 0x9A, 0xA5, 0xA6, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x51, 0x52, 0x55, 0x56, 0x66, 0x95, 0x96, 0x9A, 0xA6, 0xA7, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x54, 0x55, 0x59, 0x65, 0x69, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x45, 0x51, 0x54, 0x55, 0x56, 0x59, 0x65, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xEA, 0x00, 0x00, 0x00, 0x00 },
+        { 0x45, 0x51, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x6A, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xAB, 0xEA, 0x00 },
+        { 0x55, 0x56, 0x5A, 0x66, 0x6A, 0x95, 0x96, 0x9A, 0xA6, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x54, 0x55, 0x59, 0x65, 0x69, 0x95, 0x99, 0x9A, 0xA5, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x45, 0x54, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x69, 0x6A, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xAE, 0xEA, 0x00 },
+        { 0x45, 0x55, 0x56, 0x59, 0x5A, 0x6A, 0x95, 0x96, 0x99, 0x9A, 0xA6, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x45, 0x55, 0x56, 0x59, 0x5A, 0x66, 0x6A, 0x95, 0x96, 0x99, 0x9A, 0xA6, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x54, 0x55, 0x58, 0x59, 0x69, 0x95, 0x99, 0x9A, 0xA9, 0xAA, 0xAD, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x55, 0x59, 0x5A, 0x69, 0x6A, 0x95, 0x99, 0x9A, 0xA9, 0xAA, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x45, 0x55, 0x56, 0x59, 0x5A, 0x69, 0x6A, 0x95, 0x96, 0x99, 0x9A, 0xA9, 0xAA, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x45, 0x55, 0x56, 0x59, 0x5A, 0x6A, 0x96, 0x99, 0x9A, 0xAA, 0xAB, 0xAE, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x50, 0x51, 0x54, 0x55, 0x65, 0x95, 0xA5, 0xA6, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x51, 0x55, 0x56, 0x65, 0x66, 0x95, 0x96, 0xA5, 0xA6, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x51, 0x55, 0x56, 0x65, 0x66, 0x95, 0x96, 0xA5, 0xA6, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x51, 0x52, 0x55, 0x56, 0x65, 0x66, 0x95, 0x96, 0xA5, 0xA6, 0xA7, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x54, 0x55, 0x59, 0x65, 0x69, 0x95, 0x99, 0xA5, 0xA6, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x51, 0x54, 0x55, 0x56, 0x59, 0x65, 0x66, 0x69, 0x6A, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xBA, 0xEA, 0x00 },
+        { 0x51, 0x55, 0x56, 0x65, 0x66, 0x6A, 0x95, 0x96, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x51, 0x55, 0x56, 0x5A, 0x65, 0x66, 0x6A, 0x95, 0x96, 0x9A, 0xA5, 0xA6, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x54, 0x55, 0x59, 0x65, 0x69, 0x95, 0x99, 0xA5, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x54, 0x55, 0x59, 0x65, 0x69, 0x6A, 0x95, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00 },
+        { 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x6A, 0x95, 0x96, 0x9A, 0xA6, 0xA9, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x54, 0x55, 0x58, 0x59, 0x65, 0x69, 0x95, 0x99, 0xA5, 0xA9, 0xAA, 0xAD, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x54, 0x55, 0x59, 0x5A, 0x65, 0x69, 0x6A, 0x95, 0x99, 0x9A, 0xA5, 0xA9, 0xAA, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x55, 0x56, 0x59, 0x5A, 0x65, 0x69, 0x6A, 0x95, 0x99, 0x9A, 0xA6, 0xA9, 0xAA, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x55, 0x56, 0x59, 0x5A, 0x66, 0x69, 0x6A, 0x96, 0x99, 0x9A, 0xA6, 0xA9, 0xAA, 0xAB, 0xAE, 0xAF, 0x00, 0x00, 0x00, 0x00 },
+        { 0x50, 0x51, 0x54, 0x55, 0x61, 0x64, 0x65, 0x95, 0xA5, 0xA6, 0xA9, 0xAA, 0xB5, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x51, 0x55, 0x61, 0x65, 0x66, 0x95, 0xA5, 0xA6, 0xA9, 0xAA, 0xB6, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x51, 0x55, 0x56, 0x61, 0x65, 0x66, 0x95, 0x96, 0xA5, 0xA6, 0xAA, 0xB6, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x51, 0x55, 0x56, 0x65, 0x66, 0x6A, 0x96, 0xA5, 0xA6, 0xA7, 0xAA, 0xAB, 0xB6, 0xBA, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x54, 0x55, 0x64, 0x65, 0x69, 0x95, 0xA5, 0xA6, 0xA9, 0xAA, 0xB9, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x55, 0x65, 0x66, 0x69, 0x6A, 0x95, 0xA5, 0xA6, 0xA9, 0xAA, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x51, 0x55, 0x56, 0x65, 0x66, 0x69, 0x6A, 0x95, 0x96, 0xA5, 0xA6, 0xA9, 0xAA, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x51, 0x55, 0x56, 0x65, 0x66, 0x6A, 0x96, 0xA5, 0xA6, 0xAA, 0xAB, 0xBA, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x54, 0x55, 0x59, 0x64, 0x65, 0x69, 0x95, 0x99, 0xA5, 0xA9, 0xAA, 0xB9, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x54, 0x55, 0x59, 0x65, 0x66, 0x69, 0x6A, 0x95, 0x99, 0xA5, 0xA6, 0xA9, 0xAA, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x55, 0x56, 0x59, 0x65, 0x66, 0x69, 0x6A, 0x95, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x55, 0x56, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0x96, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xAB, 0xBA, 0xBB, 0x00, 0x00, 0x00, 0x00 },
+        { 0x54, 0x55, 0x59, 0x65, 0x69, 0x6A, 0x99, 0xA5, 0xA9, 0xAA, 0xAD, 0xAE, 0xB9, 0xBA, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x54, 0x55, 0x59, 0x65, 0x69, 0x6A, 0x99, 0xA5, 0xA9, 0xAA, 0xAE, 0xBA, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x55, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xAE, 0xBA, 0xBE, 0x00, 0x00, 0x00, 0x00 },
+        { 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0x9A, 0xA6, 0xA9, 0xAA, 0xAB, 0xAE, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x40, 0x45, 0x51, 0x54, 0x55, 0x85, 0x91, 0x94, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xEA, 0x00, 0x00, 0x00 },
+        { 0x41, 0x45, 0x51, 0x55, 0x56, 0x85, 0x91, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xAA, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x41, 0x45, 0x51, 0x55, 0x56, 0x85, 0x91, 0x95, 0x96, 0x9A, 0xA6, 0xAA, 0xD6, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x41, 0x45, 0x51, 0x55, 0x56, 0x86, 0x92, 0x95, 0x96, 0x97, 0x9A, 0xA6, 0xAA, 0xAB, 0xD6, 0xEA, 0xEB, 0x00, 0x00, 0x00 },
+        { 0x44, 0x45, 0x54, 0x55, 0x59, 0x85, 0x94, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA9, 0xAA, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x45, 0x55, 0x85, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xDA, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x45, 0x55, 0x56, 0x85, 0x95, 0x96, 0x99, 0x9A, 0xA6, 0xAA, 0xDA, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x45, 0x55, 0x56, 0x86, 0x95, 0x96, 0x9A, 0x9B, 0xA6, 0xAA, 0xAB, 0xDA, 0xEA, 0xEB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x44, 0x45, 0x54, 0x55, 0x59, 0x85, 0x94, 0x95, 0x99, 0x9A, 0xA9, 0xAA, 0xD9, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x45, 0x55, 0x59, 0x85, 0x95, 0x96, 0x99, 0x9A, 0xA9, 0xAA, 0xDA, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x45, 0x55, 0x56, 0x59, 0x5A, 0x85, 0x95, 0x96, 0x99, 0x9A, 0xAA, 0xDA, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x45, 0x55, 0x56, 0x5A, 0x95, 0x96, 0x99, 0x9A, 0x9B, 0xA6, 0xAA, 0xAB, 0xDA, 0xEA, 0xEB, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x44, 0x45, 0x54, 0x55, 0x59, 0x89, 0x95, 0x98, 0x99, 0x9A, 0x9D, 0xA9, 0xAA, 0xAE, 0xD9, 0xEA, 0xEE, 0x00, 0x00, 0x00 },
+        { 0x45, 0x55, 0x59, 0x89, 0x95, 0x99, 0x9A, 0x9E, 0xA9, 0xAA, 0xAE, 0xDA, 0xEA, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x45, 0x55, 0x59, 0x5A, 0x95, 0x96, 0x99, 0x9A, 0x9E, 0xA9, 0xAA, 0xAE, 0xDA, 0xEA, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x45, 0x55, 0x56, 0x59, 0x5A, 0x95, 0x96, 0x99, 0x9A, 0x9B, 0x9E, 0xAA, 0xAB, 0xAE, 0xDA, 0xEA, 0xEF, 0x00, 0x00, 0x00 },
+        { 0x50, 0x51, 0x54, 0x55, 0x65, 0x91, 0x94, 0x95, 0x96, 0x99, 0xA5, 0xA6, 0xA9, 0xAA, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x51, 0x55, 0x91, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xE6, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x51, 0x55, 0x56, 0x91, 0x95, 0x96, 0x9A, 0xA5, 0xA6, 0xAA, 0xE6, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x51, 0x55, 0x56, 0x92, 0x95, 0x96, 0x9A, 0xA6, 0xA7, 0xAA, 0xAB, 0xE6, 0xEA, 0xEB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x54, 0x55, 0x94, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xE9, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x55, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x55, 0x56, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x55, 0x56, 0x95, 0x96, 0x9A, 0xA6, 0xAA, 0xAB, 0xEA, 0xEB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x54, 0x55, 0x59, 0x94, 0x95, 0x99, 0x9A, 0xA5, 0xA9, 0xAA, 0xE9, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x55, 0x59, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x45, 0x55, 0x56, 0x59, 0x5A, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x45, 0x55, 0x56, 0x5A, 0x95, 0x96, 0x99, 0x9A, 0xA6, 0xAA, 0xAB, 0xEA, 0xEB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x54, 0x55, 0x59, 0x95, 0x98, 0x99, 0x9A, 0xA9, 0xAA, 0xAD, 0xAE, 0xE9, 0xEA, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x55, 0x59, 0x95, 0x99, 0x9A, 0xA9, 0xAA, 0xAE, 0xEA, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x45, 0x55, 0x59, 0x5A, 0x95, 0x96, 0x99, 0x9A, 0xA9, 0xAA, 0xAE, 0xEA, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x55, 0x56, 0x59, 0x5A, 0x95, 0x96, 0x99, 0x9A, 0xAA, 0xAB, 0xAE, 0xEA, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x50, 0x51, 0x54, 0x55, 0x65, 0x91, 0x94, 0x95, 0xA5, 0xA6, 0xA9, 0xAA, 0xE5, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x51, 0x55, 0x65, 0x91, 0x95, 0x96, 0xA5, 0xA6, 0xA9, 0xAA, 0xE6, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x51, 0x55, 0x56, 0x65, 0x66, 0x91, 0x95, 0x96, 0xA5, 0xA6, 0xAA, 0xE6, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x51, 0x55, 0x56, 0x66, 0x95, 0x96, 0x9A, 0xA5, 0xA6, 0xA7, 0xAA, 0xAB, 0xE6, 0xEA, 0xEB, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x54, 0x55, 0x65, 0x94, 0x95, 0x99, 0xA5, 0xA6, 0xA9, 0xAA, 0xE9, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x55, 0x65, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x51, 0x55, 0x56, 0x65, 0x66, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x51, 0x55, 0x56, 0x66, 0x95, 0x96, 0x9A, 0xA5, 0xA6, 0xAA, 0xAB, 0xEA, 0xEB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x54, 0x55, 0x59, 0x65, 0x69, 0x94, 0x95, 0x99, 0xA5, 0xA9, 0xAA, 0xE9, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x54, 0x55, 0x59, 0x65, 0x69, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x55, 0x56, 0x59, 0x65, 0x6A, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x55, 0x56, 0x5A, 0x66, 0x6A, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xAB, 0xEA, 0xEB, 0x00, 0x00, 0x00, 0x00 },
+        { 0x54, 0x55, 0x59, 0x69, 0x95, 0x99, 0x9A, 0xA5, 0xA9, 0xAA, 0xAD, 0xAE, 0xE9, 0xEA, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x54, 0x55, 0x59, 0x69, 0x95, 0x99, 0x9A, 0xA5, 0xA9, 0xAA, 0xAE, 0xEA, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x55, 0x59, 0x5A, 0x69, 0x6A, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xAE, 0xEA, 0xEE, 0x00, 0x00, 0x00, 0x00 },
+        { 0x55, 0x56, 0x59, 0x5A, 0x6A, 0x95, 0x96, 0x99, 0x9A, 0xA6, 0xA9, 0xAA, 0xAB, 0xAE, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x50, 0x51, 0x54, 0x55, 0x65, 0x95, 0xA1, 0xA4, 0xA5, 0xA6, 0xA9, 0xAA, 0xB5, 0xBA, 0xE5, 0xEA, 0xFA, 0x00, 0x00, 0x00 },
+        { 0x51, 0x55, 0x65, 0x95, 0xA1, 0xA5, 0xA6, 0xA9, 0xAA, 0xB6, 0xBA, 0xE6, 0xEA, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x51, 0x55, 0x65, 0x66, 0x95, 0x96, 0xA5, 0xA6, 0xA9, 0xAA, 0xB6, 0xBA, 0xE6, 0xEA, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x51, 0x55, 0x56, 0x65, 0x66, 0x95, 0x96, 0xA5, 0xA6, 0xA7, 0xAA, 0xAB, 0xB6, 0xBA, 0xE6, 0xEA, 0xFB, 0x00, 0x00, 0x00 },
+        { 0x54, 0x55, 0x65, 0x95, 0xA4, 0xA5, 0xA6, 0xA9, 0xAA, 0xB9, 0xBA, 0xE9, 0xEA, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x55, 0x65, 0x95, 0xA5, 0xA6, 0xA9, 0xAA, 0xBA, 0xEA, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x51, 0x55, 0x65, 0x66, 0x95, 0x96, 0xA5, 0xA6, 0xA9, 0xAA, 0xBA, 0xEA, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x55, 0x56, 0x65, 0x66, 0x95, 0x96, 0xA5, 0xA6, 0xAA, 0xAB, 0xBA, 0xEA, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x54, 0x55, 0x65, 0x69, 0x95, 0x99, 0xA5, 0xA6, 0xA9, 0xAA, 0xB9, 0xBA, 0xE9, 0xEA, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x54, 0x55, 0x65, 0x69, 0x95, 0x99, 0xA5, 0xA6, 0xA9, 0xAA, 0xBA, 0xEA, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x55, 0x65, 0x66, 0x69, 0x6A, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xBA, 0xEA, 0xFA, 0x00, 0x00, 0x00, 0x00 },
+        { 0x55, 0x56, 0x65, 0x66, 0x6A, 0x95, 0x96, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xAB, 0xBA, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x54, 0x55, 0x59, 0x65, 0x69, 0x95, 0x99, 0xA5, 0xA9, 0xAA, 0xAD, 0xAE, 0xB9, 0xBA, 0xE9, 0xEA, 0xFE, 0x00, 0x00, 0x00 },
+        { 0x55, 0x59, 0x65, 0x69, 0x95, 0x99, 0xA5, 0xA9, 0xAA, 0xAE, 0xBA, 0xEA, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x55, 0x59, 0x65, 0x69, 0x6A, 0x95, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xAE, 0xBA, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xAB, 0xAE, 0xBA, 0xEA },
+        // clang-format on
+    };
+}
 
-    LatticePoint4D latticePoints[256];
+constexpr std::array<std::array<OpenSimplex2S::LatticePoint4D, 20>, 256> OpenSimplex2S::LOOKUP_4D = [] {
+    std::array<LatticePoint4D, 256> latticePoints {};
     for (int i = 0; i < 256; i++) {
-        int cx = (i >> 0 & 3) - 1;
-        int cy = (i >> 2 & 3) - 1;
-        int cz = (i >> 4 & 3) - 1;
-        int cw = (i >> 6 & 3) - 1;
+        const int cx = (i >> 0 & 3) - 1;
+        const int cy = (i >> 2 & 3) - 1;
+        const int cz = (i >> 4 & 3) - 1;
+        const int cw = (i >> 6 & 3) - 1;
         latticePoints[i] = { cx, cy, cz, cw };
     }
-    for (unsigned int i = 0; i < 256; i++) {
-        constexpr unsigned char lookup4DPregenSize[256] {
-            // clang-format off
-            20, 15, 16, 17, 15, 16, 12, 15, 16, 12, 10, 14, 17, 15, 14, 17,
-            15, 16, 12, 15, 16, 14, 14, 13, 12, 14, 11, 12, 15, 13, 12, 14,
-            16, 12, 10, 14, 12, 14, 11, 12, 10, 11, 10, 13, 14, 12, 13, 15,
-            17, 15, 14, 17, 15, 13, 12, 14, 14, 12, 13, 15, 17, 14, 15, 17,
-            15, 16, 12, 15, 16, 14, 14, 13, 12, 14, 11, 12, 15, 13, 12, 14,
-            16, 14, 14, 13, 14, 16, 16, 10, 14, 16, 19, 11, 13, 10, 11, 10,
-            12, 14, 11, 12, 14, 16, 19, 11, 11, 19, 13, 14, 12, 11, 14, 13,
-            15, 13, 12, 14, 13, 10, 11, 10, 12, 11, 14, 13, 14, 10, 13, 13,
-            16, 12, 10, 14, 12, 14, 11, 12, 10, 11, 10, 13, 14, 12, 13, 15,
-            12, 14, 11, 12, 14, 16, 19, 11, 11, 19, 13, 14, 12, 11, 14, 13,
-            10, 11, 10, 13, 11, 19, 13, 14, 10, 13, 16, 14, 13, 14, 14, 16,
-            14, 12, 13, 15, 12, 11, 14, 13, 13, 14, 14, 16, 15, 13, 16, 15,
-            17, 15, 14, 17, 15, 13, 12, 14, 14, 12, 13, 15, 17, 14, 15, 17,
-            15, 13, 12, 14, 13, 10, 11, 10, 12, 11, 14, 13, 14, 10, 13, 13,
-            14, 12, 13, 15, 12, 11, 14, 13, 13, 14, 14, 16, 15, 13, 16, 15,
-            17, 14, 15, 17, 14, 10, 13, 13, 15, 13, 16, 15, 17, 13, 15, 20,
-            // clang-format on
-        };
-        LOOKUP_4D_SIZE[i] = lookup4DPregenSize[i];
-        for (unsigned char j = 0; j < lookup4DPregenSize[i]; j++) {
-            constexpr unsigned char lookup4DPregen[256][20] {
-                // clang-format off
-                { 0x15, 0x45, 0x51, 0x54, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA },
-                { 0x15, 0x45, 0x51, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x6A, 0x95, 0x96, 0x9A, 0xA6, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x01, 0x05, 0x11, 0x15, 0x41, 0x45, 0x51, 0x55, 0x56, 0x5A, 0x66, 0x6A, 0x96, 0x9A, 0xA6, 0xAA, 0x00, 0x00, 0x00, 0x00 },
-                { 0x01, 0x15, 0x16, 0x45, 0x46, 0x51, 0x52, 0x55, 0x56, 0x5A, 0x66, 0x6A, 0x96, 0x9A, 0xA6, 0xAA, 0xAB, 0x00, 0x00, 0x00 },
-                { 0x15, 0x45, 0x54, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x69, 0x6A, 0x95, 0x99, 0x9A, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x05, 0x15, 0x45, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0x95, 0x96, 0x99, 0x9A, 0xAA, 0x00, 0x00, 0x00, 0x00 },
-                { 0x05, 0x15, 0x45, 0x55, 0x56, 0x59, 0x5A, 0x66, 0x6A, 0x96, 0x9A, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x05, 0x15, 0x16, 0x45, 0x46, 0x55, 0x56, 0x59, 0x5A, 0x66, 0x6A, 0x96, 0x9A, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x04, 0x05, 0x14, 0x15, 0x44, 0x45, 0x54, 0x55, 0x59, 0x5A, 0x69, 0x6A, 0x99, 0x9A, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00 },
-                { 0x05, 0x15, 0x45, 0x55, 0x56, 0x59, 0x5A, 0x69, 0x6A, 0x99, 0x9A, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x05, 0x15, 0x45, 0x55, 0x56, 0x59, 0x5A, 0x6A, 0x9A, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x05, 0x15, 0x16, 0x45, 0x46, 0x55, 0x56, 0x59, 0x5A, 0x5B, 0x6A, 0x9A, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x04, 0x15, 0x19, 0x45, 0x49, 0x54, 0x55, 0x58, 0x59, 0x5A, 0x69, 0x6A, 0x99, 0x9A, 0xA9, 0xAA, 0xAE, 0x00, 0x00, 0x00 },
-                { 0x05, 0x15, 0x19, 0x45, 0x49, 0x55, 0x56, 0x59, 0x5A, 0x69, 0x6A, 0x99, 0x9A, 0xAA, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x05, 0x15, 0x19, 0x45, 0x49, 0x55, 0x56, 0x59, 0x5A, 0x5E, 0x6A, 0x9A, 0xAA, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x05, 0x15, 0x1A, 0x45, 0x4A, 0x55, 0x56, 0x59, 0x5A, 0x5B, 0x5E, 0x6A, 0x9A, 0xAA, 0xAB, 0xAE, 0xAF, 0x00, 0x00, 0x00 },
-                { 0x15, 0x51, 0x54, 0x55, 0x56, 0x59, 0x65, 0x66, 0x69, 0x6A, 0x95, 0xA5, 0xA6, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x11, 0x15, 0x51, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0x95, 0x96, 0xA5, 0xA6, 0xAA, 0x00, 0x00, 0x00, 0x00 },
-                { 0x11, 0x15, 0x51, 0x55, 0x56, 0x5A, 0x65, 0x66, 0x6A, 0x96, 0xA6, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x11, 0x15, 0x16, 0x51, 0x52, 0x55, 0x56, 0x5A, 0x65, 0x66, 0x6A, 0x96, 0xA6, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x14, 0x15, 0x54, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0x95, 0x99, 0xA5, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00 },
-                { 0x15, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0x95, 0x9A, 0xA6, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x15, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0x96, 0x9A, 0xA6, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x15, 0x16, 0x55, 0x56, 0x5A, 0x66, 0x6A, 0x6B, 0x96, 0x9A, 0xA6, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x14, 0x15, 0x54, 0x55, 0x59, 0x5A, 0x65, 0x69, 0x6A, 0x99, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x15, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0x99, 0x9A, 0xA9, 0xAA, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x15, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0x9A, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x15, 0x16, 0x55, 0x56, 0x59, 0x5A, 0x66, 0x6A, 0x6B, 0x9A, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x14, 0x15, 0x19, 0x54, 0x55, 0x58, 0x59, 0x5A, 0x65, 0x69, 0x6A, 0x99, 0xA9, 0xAA, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x15, 0x19, 0x55, 0x59, 0x5A, 0x69, 0x6A, 0x6E, 0x99, 0x9A, 0xA9, 0xAA, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x15, 0x19, 0x55, 0x56, 0x59, 0x5A, 0x69, 0x6A, 0x6E, 0x9A, 0xAA, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x15, 0x1A, 0x55, 0x56, 0x59, 0x5A, 0x6A, 0x6B, 0x6E, 0x9A, 0xAA, 0xAB, 0xAE, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x10, 0x11, 0x14, 0x15, 0x50, 0x51, 0x54, 0x55, 0x65, 0x66, 0x69, 0x6A, 0xA5, 0xA6, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00 },
-                { 0x11, 0x15, 0x51, 0x55, 0x56, 0x65, 0x66, 0x69, 0x6A, 0xA5, 0xA6, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x11, 0x15, 0x51, 0x55, 0x56, 0x65, 0x66, 0x6A, 0xA6, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x11, 0x15, 0x16, 0x51, 0x52, 0x55, 0x56, 0x65, 0x66, 0x67, 0x6A, 0xA6, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x14, 0x15, 0x54, 0x55, 0x59, 0x65, 0x66, 0x69, 0x6A, 0xA5, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x15, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0xA5, 0xA6, 0xA9, 0xAA, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x15, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0xA6, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x15, 0x16, 0x55, 0x56, 0x5A, 0x65, 0x66, 0x6A, 0x6B, 0xA6, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x14, 0x15, 0x54, 0x55, 0x59, 0x65, 0x69, 0x6A, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x15, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x15, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x15, 0x16, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0x6B, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x14, 0x15, 0x19, 0x54, 0x55, 0x58, 0x59, 0x65, 0x69, 0x6A, 0x6D, 0xA9, 0xAA, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x15, 0x19, 0x55, 0x59, 0x5A, 0x65, 0x69, 0x6A, 0x6E, 0xA9, 0xAA, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x15, 0x19, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0x6E, 0xAA, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x15, 0x55, 0x56, 0x59, 0x5A, 0x66, 0x69, 0x6A, 0x6B, 0x6E, 0x9A, 0xAA, 0xAB, 0xAE, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x10, 0x15, 0x25, 0x51, 0x54, 0x55, 0x61, 0x64, 0x65, 0x66, 0x69, 0x6A, 0xA5, 0xA6, 0xA9, 0xAA, 0xBA, 0x00, 0x00, 0x00 },
-                { 0x11, 0x15, 0x25, 0x51, 0x55, 0x56, 0x61, 0x65, 0x66, 0x69, 0x6A, 0xA5, 0xA6, 0xAA, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x11, 0x15, 0x25, 0x51, 0x55, 0x56, 0x61, 0x65, 0x66, 0x6A, 0x76, 0xA6, 0xAA, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x11, 0x15, 0x26, 0x51, 0x55, 0x56, 0x62, 0x65, 0x66, 0x67, 0x6A, 0x76, 0xA6, 0xAA, 0xAB, 0xBA, 0xBB, 0x00, 0x00, 0x00 },
-                { 0x14, 0x15, 0x25, 0x54, 0x55, 0x59, 0x64, 0x65, 0x66, 0x69, 0x6A, 0xA5, 0xA9, 0xAA, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x15, 0x25, 0x55, 0x65, 0x66, 0x69, 0x6A, 0x7A, 0xA5, 0xA6, 0xA9, 0xAA, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x15, 0x25, 0x55, 0x56, 0x65, 0x66, 0x69, 0x6A, 0x7A, 0xA6, 0xAA, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x15, 0x26, 0x55, 0x56, 0x65, 0x66, 0x6A, 0x6B, 0x7A, 0xA6, 0xAA, 0xAB, 0xBA, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x14, 0x15, 0x25, 0x54, 0x55, 0x59, 0x64, 0x65, 0x69, 0x6A, 0x79, 0xA9, 0xAA, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x15, 0x25, 0x55, 0x59, 0x65, 0x66, 0x69, 0x6A, 0x7A, 0xA9, 0xAA, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x15, 0x25, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0x7A, 0xAA, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x15, 0x55, 0x56, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0x6B, 0x7A, 0xA6, 0xAA, 0xAB, 0xBA, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x14, 0x15, 0x29, 0x54, 0x55, 0x59, 0x65, 0x68, 0x69, 0x6A, 0x6D, 0x79, 0xA9, 0xAA, 0xAE, 0xBA, 0xBE, 0x00, 0x00, 0x00 },
-                { 0x15, 0x29, 0x55, 0x59, 0x65, 0x69, 0x6A, 0x6E, 0x7A, 0xA9, 0xAA, 0xAE, 0xBA, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x15, 0x55, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0x6E, 0x7A, 0xA9, 0xAA, 0xAE, 0xBA, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x15, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0x6B, 0x6E, 0x7A, 0xAA, 0xAB, 0xAE, 0xBA, 0xBF, 0x00, 0x00, 0x00 },
-                { 0x45, 0x51, 0x54, 0x55, 0x56, 0x59, 0x65, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x41, 0x45, 0x51, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xAA, 0x00, 0x00, 0x00, 0x00 },
-                { 0x41, 0x45, 0x51, 0x55, 0x56, 0x5A, 0x66, 0x95, 0x96, 0x9A, 0xA6, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x41, 0x45, 0x46, 0x51, 0x52, 0x55, 0x56, 0x5A, 0x66, 0x95, 0x96, 0x9A, 0xA6, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x44, 0x45, 0x54, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x69, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00 },
-                { 0x45, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x6A, 0x95, 0x96, 0x99, 0x9A, 0xA6, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x45, 0x55, 0x56, 0x59, 0x5A, 0x66, 0x6A, 0x95, 0x96, 0x99, 0x9A, 0xA6, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x45, 0x46, 0x55, 0x56, 0x5A, 0x66, 0x6A, 0x96, 0x9A, 0x9B, 0xA6, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x44, 0x45, 0x54, 0x55, 0x59, 0x5A, 0x69, 0x95, 0x99, 0x9A, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x45, 0x55, 0x56, 0x59, 0x5A, 0x69, 0x6A, 0x95, 0x96, 0x99, 0x9A, 0xA9, 0xAA, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x45, 0x55, 0x56, 0x59, 0x5A, 0x6A, 0x95, 0x96, 0x99, 0x9A, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x45, 0x46, 0x55, 0x56, 0x59, 0x5A, 0x6A, 0x96, 0x9A, 0x9B, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x44, 0x45, 0x49, 0x54, 0x55, 0x58, 0x59, 0x5A, 0x69, 0x95, 0x99, 0x9A, 0xA9, 0xAA, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x45, 0x49, 0x55, 0x59, 0x5A, 0x69, 0x6A, 0x99, 0x9A, 0x9E, 0xA9, 0xAA, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x45, 0x49, 0x55, 0x56, 0x59, 0x5A, 0x6A, 0x99, 0x9A, 0x9E, 0xAA, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x45, 0x4A, 0x55, 0x56, 0x59, 0x5A, 0x6A, 0x9A, 0x9B, 0x9E, 0xAA, 0xAB, 0xAE, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x50, 0x51, 0x54, 0x55, 0x56, 0x59, 0x65, 0x66, 0x69, 0x95, 0x96, 0x99, 0xA5, 0xA6, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00 },
-                { 0x51, 0x55, 0x56, 0x59, 0x65, 0x66, 0x6A, 0x95, 0x96, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x51, 0x55, 0x56, 0x5A, 0x65, 0x66, 0x6A, 0x95, 0x96, 0x9A, 0xA5, 0xA6, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x51, 0x52, 0x55, 0x56, 0x5A, 0x66, 0x6A, 0x96, 0x9A, 0xA6, 0xA7, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x54, 0x55, 0x56, 0x59, 0x65, 0x69, 0x6A, 0x95, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00 },
-                { 0x15, 0x45, 0x51, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x6A, 0x95, 0x96, 0x9A, 0xA6, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00 },
-                { 0x55, 0x56, 0x5A, 0x66, 0x6A, 0x96, 0x9A, 0xA6, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x54, 0x55, 0x59, 0x5A, 0x65, 0x69, 0x6A, 0x95, 0x99, 0x9A, 0xA5, 0xA9, 0xAA, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x15, 0x45, 0x54, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x69, 0x6A, 0x95, 0x99, 0x9A, 0xA9, 0xAA, 0xAE, 0x00, 0x00, 0x00, 0x00 },
-                { 0x15, 0x45, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0x95, 0x96, 0x99, 0x9A, 0xA6, 0xA9, 0xAA, 0xAB, 0xAE, 0x00 },
-                { 0x55, 0x56, 0x59, 0x5A, 0x66, 0x6A, 0x96, 0x9A, 0xA6, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x54, 0x55, 0x58, 0x59, 0x5A, 0x69, 0x6A, 0x99, 0x9A, 0xA9, 0xAA, 0xAD, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x55, 0x59, 0x5A, 0x69, 0x6A, 0x99, 0x9A, 0xA9, 0xAA, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x55, 0x56, 0x59, 0x5A, 0x69, 0x6A, 0x99, 0x9A, 0xA9, 0xAA, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x55, 0x56, 0x59, 0x5A, 0x6A, 0x9A, 0xAA, 0xAB, 0xAE, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x50, 0x51, 0x54, 0x55, 0x65, 0x66, 0x69, 0x95, 0xA5, 0xA6, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x51, 0x55, 0x56, 0x65, 0x66, 0x69, 0x6A, 0x95, 0x96, 0xA5, 0xA6, 0xA9, 0xAA, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x51, 0x55, 0x56, 0x65, 0x66, 0x6A, 0x95, 0x96, 0xA5, 0xA6, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x51, 0x52, 0x55, 0x56, 0x65, 0x66, 0x6A, 0x96, 0xA6, 0xA7, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x54, 0x55, 0x59, 0x65, 0x66, 0x69, 0x6A, 0x95, 0x99, 0xA5, 0xA6, 0xA9, 0xAA, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x15, 0x51, 0x54, 0x55, 0x56, 0x59, 0x65, 0x66, 0x69, 0x6A, 0x95, 0xA5, 0xA6, 0xA9, 0xAA, 0xBA, 0x00, 0x00, 0x00, 0x00 },
-                { 0x15, 0x51, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0x95, 0x96, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xAB, 0xBA, 0x00 },
-                { 0x55, 0x56, 0x5A, 0x65, 0x66, 0x6A, 0x96, 0x9A, 0xA6, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x54, 0x55, 0x59, 0x65, 0x69, 0x6A, 0x95, 0x99, 0xA5, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x15, 0x54, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0x95, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xAE, 0xBA, 0x00 },
-                { 0x15, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0x9A, 0xA6, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x15, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0x96, 0x9A, 0xA6, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x54, 0x55, 0x58, 0x59, 0x65, 0x69, 0x6A, 0x99, 0xA9, 0xAA, 0xAD, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x55, 0x59, 0x5A, 0x65, 0x69, 0x6A, 0x99, 0x9A, 0xA9, 0xAA, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x15, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0x99, 0x9A, 0xA9, 0xAA, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x15, 0x55, 0x56, 0x59, 0x5A, 0x66, 0x69, 0x6A, 0x9A, 0xAA, 0xAB, 0xAE, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x50, 0x51, 0x54, 0x55, 0x61, 0x64, 0x65, 0x66, 0x69, 0x95, 0xA5, 0xA6, 0xA9, 0xAA, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x51, 0x55, 0x61, 0x65, 0x66, 0x69, 0x6A, 0xA5, 0xA6, 0xA9, 0xAA, 0xB6, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x51, 0x55, 0x56, 0x61, 0x65, 0x66, 0x6A, 0xA5, 0xA6, 0xAA, 0xB6, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x51, 0x55, 0x56, 0x62, 0x65, 0x66, 0x6A, 0xA6, 0xA7, 0xAA, 0xAB, 0xB6, 0xBA, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x54, 0x55, 0x64, 0x65, 0x66, 0x69, 0x6A, 0xA5, 0xA6, 0xA9, 0xAA, 0xB9, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x55, 0x65, 0x66, 0x69, 0x6A, 0xA5, 0xA6, 0xA9, 0xAA, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x55, 0x56, 0x65, 0x66, 0x69, 0x6A, 0xA5, 0xA6, 0xA9, 0xAA, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x55, 0x56, 0x65, 0x66, 0x6A, 0xA6, 0xAA, 0xAB, 0xBA, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x54, 0x55, 0x59, 0x64, 0x65, 0x69, 0x6A, 0xA5, 0xA9, 0xAA, 0xB9, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x55, 0x59, 0x65, 0x66, 0x69, 0x6A, 0xA5, 0xA6, 0xA9, 0xAA, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x15, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0xA5, 0xA6, 0xA9, 0xAA, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x15, 0x55, 0x56, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0xA6, 0xAA, 0xAB, 0xBA, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x54, 0x55, 0x59, 0x65, 0x68, 0x69, 0x6A, 0xA9, 0xAA, 0xAD, 0xAE, 0xB9, 0xBA, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x55, 0x59, 0x65, 0x69, 0x6A, 0xA9, 0xAA, 0xAE, 0xBA, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x15, 0x55, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0xA9, 0xAA, 0xAE, 0xBA, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0xAA, 0xAB, 0xAE, 0xBA, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x40, 0x41, 0x44, 0x45, 0x50, 0x51, 0x54, 0x55, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00 },
-                { 0x41, 0x45, 0x51, 0x55, 0x56, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x41, 0x45, 0x51, 0x55, 0x56, 0x95, 0x96, 0x9A, 0xA6, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x41, 0x45, 0x46, 0x51, 0x52, 0x55, 0x56, 0x95, 0x96, 0x97, 0x9A, 0xA6, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x44, 0x45, 0x54, 0x55, 0x59, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x45, 0x55, 0x56, 0x59, 0x5A, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x45, 0x55, 0x56, 0x59, 0x5A, 0x95, 0x96, 0x99, 0x9A, 0xA6, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x45, 0x46, 0x55, 0x56, 0x5A, 0x95, 0x96, 0x9A, 0x9B, 0xA6, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x44, 0x45, 0x54, 0x55, 0x59, 0x95, 0x99, 0x9A, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x45, 0x55, 0x56, 0x59, 0x5A, 0x95, 0x96, 0x99, 0x9A, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x45, 0x55, 0x56, 0x59, 0x5A, 0x95, 0x96, 0x99, 0x9A, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x45, 0x46, 0x55, 0x56, 0x59, 0x5A, 0x95, 0x96, 0x99, 0x9A, 0x9B, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x44, 0x45, 0x49, 0x54, 0x55, 0x58, 0x59, 0x95, 0x99, 0x9A, 0x9D, 0xA9, 0xAA, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x45, 0x49, 0x55, 0x59, 0x5A, 0x95, 0x99, 0x9A, 0x9E, 0xA9, 0xAA, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x45, 0x49, 0x55, 0x56, 0x59, 0x5A, 0x95, 0x96, 0x99, 0x9A, 0x9E, 0xAA, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x45, 0x55, 0x56, 0x59, 0x5A, 0x6A, 0x96, 0x99, 0x9A, 0x9B, 0x9E, 0xAA, 0xAB, 0xAE, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x50, 0x51, 0x54, 0x55, 0x65, 0x95, 0x96, 0x99, 0xA5, 0xA6, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x51, 0x55, 0x56, 0x65, 0x66, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x51, 0x55, 0x56, 0x65, 0x66, 0x95, 0x96, 0x9A, 0xA5, 0xA6, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x51, 0x52, 0x55, 0x56, 0x66, 0x95, 0x96, 0x9A, 0xA6, 0xA7, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x54, 0x55, 0x59, 0x65, 0x69, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x45, 0x51, 0x54, 0x55, 0x56, 0x59, 0x65, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xEA, 0x00, 0x00, 0x00, 0x00 },
-                { 0x45, 0x51, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x6A, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xAB, 0xEA, 0x00 },
-                { 0x55, 0x56, 0x5A, 0x66, 0x6A, 0x95, 0x96, 0x9A, 0xA6, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x54, 0x55, 0x59, 0x65, 0x69, 0x95, 0x99, 0x9A, 0xA5, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x45, 0x54, 0x55, 0x56, 0x59, 0x5A, 0x65, 0x69, 0x6A, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xAE, 0xEA, 0x00 },
-                { 0x45, 0x55, 0x56, 0x59, 0x5A, 0x6A, 0x95, 0x96, 0x99, 0x9A, 0xA6, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x45, 0x55, 0x56, 0x59, 0x5A, 0x66, 0x6A, 0x95, 0x96, 0x99, 0x9A, 0xA6, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x54, 0x55, 0x58, 0x59, 0x69, 0x95, 0x99, 0x9A, 0xA9, 0xAA, 0xAD, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x55, 0x59, 0x5A, 0x69, 0x6A, 0x95, 0x99, 0x9A, 0xA9, 0xAA, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x45, 0x55, 0x56, 0x59, 0x5A, 0x69, 0x6A, 0x95, 0x96, 0x99, 0x9A, 0xA9, 0xAA, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x45, 0x55, 0x56, 0x59, 0x5A, 0x6A, 0x96, 0x99, 0x9A, 0xAA, 0xAB, 0xAE, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x50, 0x51, 0x54, 0x55, 0x65, 0x95, 0xA5, 0xA6, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x51, 0x55, 0x56, 0x65, 0x66, 0x95, 0x96, 0xA5, 0xA6, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x51, 0x55, 0x56, 0x65, 0x66, 0x95, 0x96, 0xA5, 0xA6, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x51, 0x52, 0x55, 0x56, 0x65, 0x66, 0x95, 0x96, 0xA5, 0xA6, 0xA7, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x54, 0x55, 0x59, 0x65, 0x69, 0x95, 0x99, 0xA5, 0xA6, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x51, 0x54, 0x55, 0x56, 0x59, 0x65, 0x66, 0x69, 0x6A, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xBA, 0xEA, 0x00 },
-                { 0x51, 0x55, 0x56, 0x65, 0x66, 0x6A, 0x95, 0x96, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x51, 0x55, 0x56, 0x5A, 0x65, 0x66, 0x6A, 0x95, 0x96, 0x9A, 0xA5, 0xA6, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x54, 0x55, 0x59, 0x65, 0x69, 0x95, 0x99, 0xA5, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x54, 0x55, 0x59, 0x65, 0x69, 0x6A, 0x95, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0x00, 0x00, 0x00, 0x00 },
-                { 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x6A, 0x95, 0x96, 0x9A, 0xA6, 0xA9, 0xAA, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x54, 0x55, 0x58, 0x59, 0x65, 0x69, 0x95, 0x99, 0xA5, 0xA9, 0xAA, 0xAD, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x54, 0x55, 0x59, 0x5A, 0x65, 0x69, 0x6A, 0x95, 0x99, 0x9A, 0xA5, 0xA9, 0xAA, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x55, 0x56, 0x59, 0x5A, 0x65, 0x69, 0x6A, 0x95, 0x99, 0x9A, 0xA6, 0xA9, 0xAA, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x55, 0x56, 0x59, 0x5A, 0x66, 0x69, 0x6A, 0x96, 0x99, 0x9A, 0xA6, 0xA9, 0xAA, 0xAB, 0xAE, 0xAF, 0x00, 0x00, 0x00, 0x00 },
-                { 0x50, 0x51, 0x54, 0x55, 0x61, 0x64, 0x65, 0x95, 0xA5, 0xA6, 0xA9, 0xAA, 0xB5, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x51, 0x55, 0x61, 0x65, 0x66, 0x95, 0xA5, 0xA6, 0xA9, 0xAA, 0xB6, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x51, 0x55, 0x56, 0x61, 0x65, 0x66, 0x95, 0x96, 0xA5, 0xA6, 0xAA, 0xB6, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x51, 0x55, 0x56, 0x65, 0x66, 0x6A, 0x96, 0xA5, 0xA6, 0xA7, 0xAA, 0xAB, 0xB6, 0xBA, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x54, 0x55, 0x64, 0x65, 0x69, 0x95, 0xA5, 0xA6, 0xA9, 0xAA, 0xB9, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x55, 0x65, 0x66, 0x69, 0x6A, 0x95, 0xA5, 0xA6, 0xA9, 0xAA, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x51, 0x55, 0x56, 0x65, 0x66, 0x69, 0x6A, 0x95, 0x96, 0xA5, 0xA6, 0xA9, 0xAA, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x51, 0x55, 0x56, 0x65, 0x66, 0x6A, 0x96, 0xA5, 0xA6, 0xAA, 0xAB, 0xBA, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x54, 0x55, 0x59, 0x64, 0x65, 0x69, 0x95, 0x99, 0xA5, 0xA9, 0xAA, 0xB9, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x54, 0x55, 0x59, 0x65, 0x66, 0x69, 0x6A, 0x95, 0x99, 0xA5, 0xA6, 0xA9, 0xAA, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x55, 0x56, 0x59, 0x65, 0x66, 0x69, 0x6A, 0x95, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x55, 0x56, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0x96, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xAB, 0xBA, 0xBB, 0x00, 0x00, 0x00, 0x00 },
-                { 0x54, 0x55, 0x59, 0x65, 0x69, 0x6A, 0x99, 0xA5, 0xA9, 0xAA, 0xAD, 0xAE, 0xB9, 0xBA, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x54, 0x55, 0x59, 0x65, 0x69, 0x6A, 0x99, 0xA5, 0xA9, 0xAA, 0xAE, 0xBA, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x55, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xAE, 0xBA, 0xBE, 0x00, 0x00, 0x00, 0x00 },
-                { 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0x9A, 0xA6, 0xA9, 0xAA, 0xAB, 0xAE, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x40, 0x45, 0x51, 0x54, 0x55, 0x85, 0x91, 0x94, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xEA, 0x00, 0x00, 0x00 },
-                { 0x41, 0x45, 0x51, 0x55, 0x56, 0x85, 0x91, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xAA, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x41, 0x45, 0x51, 0x55, 0x56, 0x85, 0x91, 0x95, 0x96, 0x9A, 0xA6, 0xAA, 0xD6, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x41, 0x45, 0x51, 0x55, 0x56, 0x86, 0x92, 0x95, 0x96, 0x97, 0x9A, 0xA6, 0xAA, 0xAB, 0xD6, 0xEA, 0xEB, 0x00, 0x00, 0x00 },
-                { 0x44, 0x45, 0x54, 0x55, 0x59, 0x85, 0x94, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA9, 0xAA, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x45, 0x55, 0x85, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xDA, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x45, 0x55, 0x56, 0x85, 0x95, 0x96, 0x99, 0x9A, 0xA6, 0xAA, 0xDA, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x45, 0x55, 0x56, 0x86, 0x95, 0x96, 0x9A, 0x9B, 0xA6, 0xAA, 0xAB, 0xDA, 0xEA, 0xEB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x44, 0x45, 0x54, 0x55, 0x59, 0x85, 0x94, 0x95, 0x99, 0x9A, 0xA9, 0xAA, 0xD9, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x45, 0x55, 0x59, 0x85, 0x95, 0x96, 0x99, 0x9A, 0xA9, 0xAA, 0xDA, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x45, 0x55, 0x56, 0x59, 0x5A, 0x85, 0x95, 0x96, 0x99, 0x9A, 0xAA, 0xDA, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x45, 0x55, 0x56, 0x5A, 0x95, 0x96, 0x99, 0x9A, 0x9B, 0xA6, 0xAA, 0xAB, 0xDA, 0xEA, 0xEB, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x44, 0x45, 0x54, 0x55, 0x59, 0x89, 0x95, 0x98, 0x99, 0x9A, 0x9D, 0xA9, 0xAA, 0xAE, 0xD9, 0xEA, 0xEE, 0x00, 0x00, 0x00 },
-                { 0x45, 0x55, 0x59, 0x89, 0x95, 0x99, 0x9A, 0x9E, 0xA9, 0xAA, 0xAE, 0xDA, 0xEA, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x45, 0x55, 0x59, 0x5A, 0x95, 0x96, 0x99, 0x9A, 0x9E, 0xA9, 0xAA, 0xAE, 0xDA, 0xEA, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x45, 0x55, 0x56, 0x59, 0x5A, 0x95, 0x96, 0x99, 0x9A, 0x9B, 0x9E, 0xAA, 0xAB, 0xAE, 0xDA, 0xEA, 0xEF, 0x00, 0x00, 0x00 },
-                { 0x50, 0x51, 0x54, 0x55, 0x65, 0x91, 0x94, 0x95, 0x96, 0x99, 0xA5, 0xA6, 0xA9, 0xAA, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x51, 0x55, 0x91, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xE6, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x51, 0x55, 0x56, 0x91, 0x95, 0x96, 0x9A, 0xA5, 0xA6, 0xAA, 0xE6, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x51, 0x55, 0x56, 0x92, 0x95, 0x96, 0x9A, 0xA6, 0xA7, 0xAA, 0xAB, 0xE6, 0xEA, 0xEB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x54, 0x55, 0x94, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xE9, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x55, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x55, 0x56, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x55, 0x56, 0x95, 0x96, 0x9A, 0xA6, 0xAA, 0xAB, 0xEA, 0xEB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x54, 0x55, 0x59, 0x94, 0x95, 0x99, 0x9A, 0xA5, 0xA9, 0xAA, 0xE9, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x55, 0x59, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x45, 0x55, 0x56, 0x59, 0x5A, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x45, 0x55, 0x56, 0x5A, 0x95, 0x96, 0x99, 0x9A, 0xA6, 0xAA, 0xAB, 0xEA, 0xEB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x54, 0x55, 0x59, 0x95, 0x98, 0x99, 0x9A, 0xA9, 0xAA, 0xAD, 0xAE, 0xE9, 0xEA, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x55, 0x59, 0x95, 0x99, 0x9A, 0xA9, 0xAA, 0xAE, 0xEA, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x45, 0x55, 0x59, 0x5A, 0x95, 0x96, 0x99, 0x9A, 0xA9, 0xAA, 0xAE, 0xEA, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x55, 0x56, 0x59, 0x5A, 0x95, 0x96, 0x99, 0x9A, 0xAA, 0xAB, 0xAE, 0xEA, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x50, 0x51, 0x54, 0x55, 0x65, 0x91, 0x94, 0x95, 0xA5, 0xA6, 0xA9, 0xAA, 0xE5, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x51, 0x55, 0x65, 0x91, 0x95, 0x96, 0xA5, 0xA6, 0xA9, 0xAA, 0xE6, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x51, 0x55, 0x56, 0x65, 0x66, 0x91, 0x95, 0x96, 0xA5, 0xA6, 0xAA, 0xE6, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x51, 0x55, 0x56, 0x66, 0x95, 0x96, 0x9A, 0xA5, 0xA6, 0xA7, 0xAA, 0xAB, 0xE6, 0xEA, 0xEB, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x54, 0x55, 0x65, 0x94, 0x95, 0x99, 0xA5, 0xA6, 0xA9, 0xAA, 0xE9, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x55, 0x65, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x51, 0x55, 0x56, 0x65, 0x66, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x51, 0x55, 0x56, 0x66, 0x95, 0x96, 0x9A, 0xA5, 0xA6, 0xAA, 0xAB, 0xEA, 0xEB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x54, 0x55, 0x59, 0x65, 0x69, 0x94, 0x95, 0x99, 0xA5, 0xA9, 0xAA, 0xE9, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x54, 0x55, 0x59, 0x65, 0x69, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x55, 0x56, 0x59, 0x65, 0x6A, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x55, 0x56, 0x5A, 0x66, 0x6A, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xAB, 0xEA, 0xEB, 0x00, 0x00, 0x00, 0x00 },
-                { 0x54, 0x55, 0x59, 0x69, 0x95, 0x99, 0x9A, 0xA5, 0xA9, 0xAA, 0xAD, 0xAE, 0xE9, 0xEA, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x54, 0x55, 0x59, 0x69, 0x95, 0x99, 0x9A, 0xA5, 0xA9, 0xAA, 0xAE, 0xEA, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x55, 0x59, 0x5A, 0x69, 0x6A, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xAE, 0xEA, 0xEE, 0x00, 0x00, 0x00, 0x00 },
-                { 0x55, 0x56, 0x59, 0x5A, 0x6A, 0x95, 0x96, 0x99, 0x9A, 0xA6, 0xA9, 0xAA, 0xAB, 0xAE, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x50, 0x51, 0x54, 0x55, 0x65, 0x95, 0xA1, 0xA4, 0xA5, 0xA6, 0xA9, 0xAA, 0xB5, 0xBA, 0xE5, 0xEA, 0xFA, 0x00, 0x00, 0x00 },
-                { 0x51, 0x55, 0x65, 0x95, 0xA1, 0xA5, 0xA6, 0xA9, 0xAA, 0xB6, 0xBA, 0xE6, 0xEA, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x51, 0x55, 0x65, 0x66, 0x95, 0x96, 0xA5, 0xA6, 0xA9, 0xAA, 0xB6, 0xBA, 0xE6, 0xEA, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x51, 0x55, 0x56, 0x65, 0x66, 0x95, 0x96, 0xA5, 0xA6, 0xA7, 0xAA, 0xAB, 0xB6, 0xBA, 0xE6, 0xEA, 0xFB, 0x00, 0x00, 0x00 },
-                { 0x54, 0x55, 0x65, 0x95, 0xA4, 0xA5, 0xA6, 0xA9, 0xAA, 0xB9, 0xBA, 0xE9, 0xEA, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x55, 0x65, 0x95, 0xA5, 0xA6, 0xA9, 0xAA, 0xBA, 0xEA, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x51, 0x55, 0x65, 0x66, 0x95, 0x96, 0xA5, 0xA6, 0xA9, 0xAA, 0xBA, 0xEA, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x55, 0x56, 0x65, 0x66, 0x95, 0x96, 0xA5, 0xA6, 0xAA, 0xAB, 0xBA, 0xEA, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x54, 0x55, 0x65, 0x69, 0x95, 0x99, 0xA5, 0xA6, 0xA9, 0xAA, 0xB9, 0xBA, 0xE9, 0xEA, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x54, 0x55, 0x65, 0x69, 0x95, 0x99, 0xA5, 0xA6, 0xA9, 0xAA, 0xBA, 0xEA, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x55, 0x65, 0x66, 0x69, 0x6A, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xBA, 0xEA, 0xFA, 0x00, 0x00, 0x00, 0x00 },
-                { 0x55, 0x56, 0x65, 0x66, 0x6A, 0x95, 0x96, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xAB, 0xBA, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x54, 0x55, 0x59, 0x65, 0x69, 0x95, 0x99, 0xA5, 0xA9, 0xAA, 0xAD, 0xAE, 0xB9, 0xBA, 0xE9, 0xEA, 0xFE, 0x00, 0x00, 0x00 },
-                { 0x55, 0x59, 0x65, 0x69, 0x95, 0x99, 0xA5, 0xA9, 0xAA, 0xAE, 0xBA, 0xEA, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x55, 0x59, 0x65, 0x69, 0x6A, 0x95, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xAE, 0xBA, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00 },
-                { 0x55, 0x56, 0x59, 0x5A, 0x65, 0x66, 0x69, 0x6A, 0x95, 0x96, 0x99, 0x9A, 0xA5, 0xA6, 0xA9, 0xAA, 0xAB, 0xAE, 0xBA, 0xEA },
-                // clang-format on
-            };
-            LOOKUP_4D[i][j] = latticePoints[lookup4DPregen[i][j]];
+    std::array<std::array<LatticePoint4D, 20>, 256> lookup {};
+    for (int i = 0; i < 256; i++) {
+        for (int j = 0; j < LOOKUP_4D_SIZE[i]; j++) {
+            lookup[i][j] = latticePoints[LOOKUP_4D_PREGEN[i][j]];
         }
     }
-}
+    return lookup;
+}();
+
+// Gradient sets, normalized at compile time
 
-void OpenSimplex2S::initGradients() {
-    static constexpr int grad2_size = 24;
-    Grad2 grad2[grad2_size] {
+constexpr std::array<OpenSimplex2S::Grad2, 24> OpenSimplex2S::GRADIENTS_2D = [] {
+    std::array<Grad2, 24> grad2 {{
     { 0.130526192220052, 0.99144486137381 },    { 0.38268343236509, 0.923879532511287 },
     { 0.608761429008721, 0.793353340291235 },   { 0.793353340291235, 0.608761429008721 },
     { 0.923879532511287, 0.38268343236509 },    { 0.99144486137381, 0.130526192220051 },
@@ -798,17 +1459,16 @@ void OpenSimplex2S::initGradients() {
     { -0.99144486137381, 0.130526192220051 },   { -0.923879532511287, 0.38268343236509 },
     { -0.793353340291235, 0.608761429008721 },  { -0.608761429008721, 0.793353340291235 },
     { -0.38268343236509, 0.923879532511287 },   { -0.130526192220052, 0.99144486137381 },
-    };
-    for (int i = 0; i < grad2_size; i++) {
-        grad2[i].dx /= N2;
-        grad2[i].dy /= N2;
-    }
-    for (int i = 0; i < PSIZE; i++) {
-        GRADIENTS_2D[i] = grad2[i % grad2_size];
+    }};
+    for (Grad2& grad : grad2) {
+        grad.dx /= N2;
+        grad.dy /= N2;
     }
+    return grad2;
+}();
 
-    static constexpr int grad3_size = 48;
-    Grad3 grad3[grad3_size] {
+constexpr std::array<OpenSimplex2S::Grad3, 48> OpenSimplex2S::GRADIENTS_3D = [] {
+    std::array<Grad3, 48> grad3 {{
     { -2.22474487139, -2.22474487139, -1.0 },
     { -2.22474487139, -2.22474487139, 1.0 },
     { -3.0862664687972017, -1.1721513422464978, 0.0 },
@@ -857,18 +1517,17 @@ void OpenSimplex2S::initGradients() {
     { 2.22474487139, 2.22474487139, 1.0 },
     { 3.0862664687972017, 1.1721513422464978, 0.0 },
     { 1.1721513422464978, 3.0862664687972017, 0.0 },
-    };
-    for (int i = 0; i < grad3_size; i++) {
-        grad3[i].dx /= N3;
-        grad3[i].dy /= N3;
-        grad3[i].dz /= N3;
-    }
-    for (int i = 0; i < PSIZE; i++) {
-        GRADIENTS_3D[i] = grad3[i % grad3_size];
+    }};
+    for (Grad3& grad : grad3) {
+        grad.dx /= N3;
+        grad.dy /= N3;
+        grad.dz /= N3;
     }
+    return grad3;
+}();
 
-    static constexpr int grad4_size = 160;
-    Grad4 grad4[grad4_size] {
+constexpr std::array<OpenSimplex2S::Grad4, 160> OpenSimplex2S::GRADIENTS_4D = [] {
+    std::array<Grad4, 160> grad4 {{
     { -0.753341017856078, -0.37968289875261624, -0.37968289875261624, -0.37968289875261624 },
     { -0.7821684431180708, -0.4321472685365301, -0.4321472685365301, 0.12128480194602098 },
     { -0.7821684431180708, -0.4321472685365301, 0.12128480194602098, -0.4321472685365301 },
@@ -1029,14 +1688,12 @@ void OpenSimplex2S::initGradients() {
     { 0.7821684431180708, 0.4321472685365301, -0.12128480194602098, 0.4321472685365301 },
     { 0.7821684431180708, 0.4321472685365301, 0.4321472685365301, -0.12128480194602098 },
     { 0.753341017856078, 0.37968289875261624, 0.37968289875261624, 0.37968289875261624 },
-    };
-    for (int i = 0; i < grad4_size; i++) {
-        grad4[i].dx /= N4;
-        grad4[i].dy /= N4;
-        grad4[i].dz /= N4;
-        grad4[i].dw /= N4;
-    }
-    for (int i = 0; i < PSIZE; i++) {
-        GRADIENTS_4D[i] = grad4[i % grad4_size];
+    }};
+    for (Grad4& grad : grad4) {
+        grad.dx /= N4;
+        grad.dy /= N4;
+        grad.dz /= N4;
+        grad.dw /= N4;
     }
-}
\ No newline at end of file
+    return grad4;
+}();